@@ -0,0 +1,30 @@
+///////////////////////////////////////////////////////
+// AVR TIMER LIBRARY
+// DEVICE SELECTION
+//
+// INCLUDES THE TIMER DRIVER MATCHING THE TARGET MCU SO
+// THE DEVICE INDEPENDENT MODULES (SCHEDULER ETC) CAN BE
+// BUILT FOR EITHER PART
+//	1. ATMEGA8		-> AVR_TIMER_ATMEGA8.h
+//	2. ATMEGAxx8	-> AVR_TIMER_ATMEGA328.h
+//	   (ATMEGA48/88/168/328 AND THEIR A/P/PA VARIANTS)
+// ANY OTHER PART IS A BUILD ERROR
+//
+// OCTOBER 18, 2026
+///////////////////////////////////////////////////////
+
+#ifndef _AVR_TIMER_H_
+#define _AVR_TIMER_H_
+
+#if defined(__AVR_ATmega8__)
+#include "AVR_TIMER_ATMEGA8.h"
+#elif defined(__AVR_ATmega48__) || defined(__AVR_ATmega48A__) || defined(__AVR_ATmega48P__) || defined(__AVR_ATmega48PA__) || \
+	defined(__AVR_ATmega88__) || defined(__AVR_ATmega88A__) || defined(__AVR_ATmega88P__) || defined(__AVR_ATmega88PA__) || \
+	defined(__AVR_ATmega168__) || defined(__AVR_ATmega168A__) || defined(__AVR_ATmega168P__) || defined(__AVR_ATmega168PA__) || \
+	defined(__AVR_ATmega328__) || defined(__AVR_ATmega328P__)
+#include "AVR_TIMER_ATMEGA328.h"
+#else
+#error "AVR_TIMER : UNSUPPORTED MCU (ATMEGA8 OR ATMEGA48/88/168/328 ONLY)"
+#endif
+
+#endif
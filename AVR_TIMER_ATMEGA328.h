@@ -16,6 +16,9 @@
 //		SET ONLY FOR THIS EVENT. NO OVERFLOW EVENT
 //		--- OCA (REQUIRED)
 //      --- INTERRUPTS POSSIBLE : OCA
+//	3. COMPLEMENTARY PWM PAIR (TIMER1 ONLY) (TOP = ICR1)
+//		PHASE CORRECT PWM. OC1A NON INVERTING, OC1B INVERTING
+//		WITH A DEAD TIME BETWEEN THEM FOR HALF BRIDGE DRIVES
 //
 // * AT A GIVEN TIME, TIMER CAN BE NORMAL OR CTC MODE
 // BUT NOT BOTH
@@ -26,6 +29,9 @@
 // ONLY SUPPORTS THE FOLLOWING CLOCK SOURCES:
 //	1. INTERNAL (FROM IO CLOCK)
 //
+// * TIMERS, CHANNELS AND MODES NOT NEEDED BY A BUILD
+// CAN BE COMPILED OUT IN AVR_TIMER_CONFIG.h
+//
 //	EXAMPLE USAGE:
 //		* ALWAYS SET THE OC A/B CHANNELS BEFORE SETTING
 //		  THE NORMAL / CTC MODES. SETTING THESE MODES
@@ -52,6 +58,7 @@
 
 #include <stdio.h>
 #include <avr/io.h>
+#include "AVR_TIMER_CONFIG.h"
 
 #define AVR_TIMER_8BIT_TIMER0	0
 #define AVR_TIMER_16BIT_TIMER1	1
@@ -92,13 +99,50 @@
 #define AVR_TIMER_FLAG_OCA_MATCH	0x02
 #define AVR_TIMER_FLAG_OCB_MATCH	0x04
 
+#define AVR_TIMER_EVENT_OVERFLOW	0
+#define AVR_TIMER_EVENT_OCA_MATCH	1
+#define AVR_TIMER_EVENT_OCB_MATCH	2
+
+#define AVR_TIMER_RETUNE_REJECTED	0
+#define AVR_TIMER_RETUNE_APPLIED	1
+#define AVR_TIMER_RETUNE_SCHEDULED	2
+
+typedef void (*AVR_TIMER_CALLBACK)(uint8_t timer_num, uint8_t timer_event);
+typedef uint8_t (*AVR_TIMER_DAC_REFILL)(uint8_t* buffer, uint8_t length);
+
+#if AVR_TIMER_CONFIG_MODE_NORMAL
 void AVR_TIMER_Enable_Mode_Normal(uint8_t timer_num, uint8_t timer_clock, uint8_t interrupt_enable);
+#endif
+#if AVR_TIMER_CONFIG_MODE_CTC
 void AVR_TIMER_Enable_Mode_Ctc(uint8_t timer_num, uint8_t timer_clock);
+#endif
+#if AVR_TIMER_CONFIG_OCA
 void AVR_TIMER_Set_Oca_parameters(uint8_t timer_num, uint8_t oc_mode, uint16_t top_value, uint8_t interrupt_enable);
+#endif
+#if AVR_TIMER_CONFIG_OCB
 void AVR_TIMER_Set_Ocb_parameters(uint8_t timer_num, uint8_t oc_mode, uint16_t top_value, uint8_t interrupt_enable);
+#endif
 uint8_t AVR_TIMER_Get_Flag_Value(uint8_t timer_num, uint8_t timer_flag);
 void AVR_TIMER_Clear_Flag(uint8_t timer_num, uint8_t timer_flag);
 void AVR_TIMER_Disable(uint8_t timer_num);
+uint16_t AVR_TIMER_Get_Count(uint8_t timer_num);
+#if AVR_TIMER_CONFIG_RETUNE
+uint8_t AVR_TIMER_Retune_Ctc(uint8_t timer_num, uint16_t top_value);
+#endif
+#if AVR_TIMER_CONFIG_COMPLEMENTARY
+void AVR_TIMER_Enable_Mode_Complementary(uint8_t timer_clock, uint16_t top_value, uint16_t dead_time);
+uint16_t AVR_TIMER_Set_Complementary_Duty(uint16_t duty);
+#endif
+#if AVR_TIMER_CONFIG_DAC
+uint8_t AVR_TIMER_Dac_Start(uint32_t sample_rate, AVR_TIMER_DAC_REFILL refill);
+void AVR_TIMER_Dac_Stop(void);
+uint8_t AVR_TIMER_Dac_Write(const uint8_t* samples, uint8_t length);
+uint8_t AVR_TIMER_Dac_Service(void);
+uint16_t AVR_TIMER_Dac_Get_Underruns(void);
+#endif
+#if AVR_TIMER_CONFIG_ISR
+void AVR_TIMER_Set_Callback(uint8_t timer_num, uint8_t timer_event, AVR_TIMER_CALLBACK callback);
+#endif
 
 
 #endif
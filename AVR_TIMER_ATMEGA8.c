@@ -55,7 +55,63 @@
 ///////////////////////////////////////////////////////
 
 #include "AVR_TIMER_ATMEGA8.h"
+#include "AVR_TIMER_TRACE.h"
+#include <util/atomic.h>
 
+#if AVR_TIMER_CONFIG_ISR || AVR_TIMER_CONFIG_DAC
+#include <avr/interrupt.h>
+#endif
+
+#if AVR_TIMER_CONFIG_ISR
+//CALLBACKS FOR THE LIBRARY OWNED ISRs
+#if AVR_TIMER_CONFIG_TIMER0 && AVR_TIMER_CONFIG_MODE_NORMAL
+static volatile AVR_TIMER_CALLBACK timer0_ovf_callback;
+#endif
+#if AVR_TIMER_CONFIG_TIMER1 && AVR_TIMER_CONFIG_MODE_NORMAL
+static volatile AVR_TIMER_CALLBACK timer1_ovf_callback;
+#endif
+#if AVR_TIMER_CONFIG_TIMER1 && AVR_TIMER_CONFIG_OCA && !AVR_TIMER_CONFIG_DAC
+static volatile AVR_TIMER_CALLBACK timer1_oca_callback;
+#endif
+#if AVR_TIMER_CONFIG_TIMER1 && AVR_TIMER_CONFIG_OCB
+static volatile AVR_TIMER_CALLBACK timer1_ocb_callback;
+#endif
+#if AVR_TIMER_CONFIG_TIMER2 && AVR_TIMER_CONFIG_MODE_NORMAL
+static volatile AVR_TIMER_CALLBACK timer2_ovf_callback;
+#endif
+#if AVR_TIMER_CONFIG_TIMER2 && AVR_TIMER_CONFIG_OCA
+static volatile AVR_TIMER_CALLBACK timer2_oca_callback;
+#endif
+
+//PENDING CTC TOP VALUES (0 = NONE) APPLIED BY THE COMPARE ISRs
+#if AVR_TIMER_CONFIG_RETUNE && AVR_TIMER_CONFIG_TIMER1
+static volatile uint16_t timer1_retune_top;
+#endif
+#if AVR_TIMER_CONFIG_RETUNE && AVR_TIMER_CONFIG_TIMER2
+static volatile uint8_t timer2_retune_top;
+#endif
+#endif
+
+#if AVR_TIMER_CONFIG_DAC
+//DAC SAMPLE RING BUFFER. dac_head IS ONLY WRITTEN BY THE MAIN
+//LOOP AND dac_tail ONLY BY THE SAMPLE CLOCK ISR. BOTH RUN FREE
+//AND ARE MASKED ON ACCESS
+#define DAC_BUFFER_MASK	(AVR_TIMER_CONFIG_DAC_BUFFER_SIZE - 1)
+static uint8_t dac_buffer[AVR_TIMER_CONFIG_DAC_BUFFER_SIZE];
+static volatile uint8_t dac_head;
+static volatile uint8_t dac_tail;
+static volatile uint16_t dac_underruns;
+static AVR_TIMER_DAC_REFILL dac_refill;
+#endif
+
+#if AVR_TIMER_CONFIG_COMPLEMENTARY
+//COMPLEMENTARY PAIR SETTINGS. DUTY IS THE CURRENT OCR1A
+static uint16_t complementary_top;
+static uint16_t complementary_dead_time;
+static uint16_t complementary_duty;
+#endif
+
+#if AVR_TIMER_CONFIG_MODE_NORMAL
 void AVR_TIMER_Enable_Mode_Normal(uint8_t timer_num, uint8_t timer_clock, uint8_t interrupt_enable)
 {
 	//INITIALIZE AND START THE TIMER IN NORMAL MODE WITH THE SPECIFIED
@@ -68,6 +124,7 @@ void AVR_TIMER_Enable_Mode_Normal(uint8_t timer_num, uint8_t timer_clock, uint8_
 	
 	switch(timer_num)
 	{
+#if AVR_TIMER_CONFIG_TIMER0
 		case AVR_TIMER_8BIT_TIMER0:
 			//CLEAR COUNT AND SET CLOCK
 			TCNT0 = 0x00;
@@ -78,7 +135,9 @@ void AVR_TIMER_Enable_Mode_Normal(uint8_t timer_num, uint8_t timer_clock, uint8_
 			//APPLY CLOCK. START THE TIMER
 			TCCR0 |= timer_clock;
 			break;
+#endif
 
+#if AVR_TIMER_CONFIG_TIMER2
 		case AVR_TIMER_8BIT_TIMER2:
 			//CLEAR MODE AND SET NORMAL MODE
 			TCCR2 &= ~((1 << WGM21) | (1 << WGM20));
@@ -90,11 +149,18 @@ void AVR_TIMER_Enable_Mode_Normal(uint8_t timer_num, uint8_t timer_clock, uint8_
 			//APPLY CLOCK. START THE TIMER
 			TCCR2 |= timer_clock;
 			break;
+#endif
 
+#if AVR_TIMER_CONFIG_TIMER1
 		case AVR_TIMER_16BIT_TIMER1:
 			//CLEAR MODE AND SET NORMAL MODE
 			TCCR1A &= ~((1 << WGM11) | (1 << WGM10));
-			TCNT1 = 0x0000;
+			//16 BIT WRITES GO THROUGH THE TEMP REGISTER SHARED WITH
+			//ISRs (E.G. THE TRACE CLOCK READ). INTERRUPTS OFF
+			ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+			{
+				TCNT1 = 0x0000;
+			}
 			if(interrupt_enable == AVR_TIMER_INTERRUPT_ON)
 			{
 				TIMSK |= (1 << TOIE1);
@@ -102,12 +168,16 @@ void AVR_TIMER_Enable_Mode_Normal(uint8_t timer_num, uint8_t timer_clock, uint8_
 			//APPLY CLOCK. START THE TIMER
 			TCCR1B |= timer_clock;
 			break;
+#endif
 
 		default:
 			break;
 	}
+	AVR_TIMER_TRACE_MODE(timer_num, AVR_TIMER_TRACE_MODE_NORMAL);
 }
+#endif
 
+#if AVR_TIMER_ATMEGA8_CTC
 void AVR_TIMER_Enable_Mode_Ctc(uint8_t timer_num, uint8_t timer_clock)
 {
 	//INITIALIZE AND START THE TIMER IN CTC MODE WITH THE SPECIFIED
@@ -115,11 +185,7 @@ void AVR_TIMER_Enable_Mode_Ctc(uint8_t timer_num, uint8_t timer_clock)
 	
 	switch(timer_num)
 	{
-		case AVR_TIMER_8BIT_TIMER0:
-			//TIMER0 IN ATMEGA8 DOES NOT HAVE CTC MODE
-			return;
-			break;
-
+#if AVR_TIMER_CONFIG_TIMER2
 		case AVR_TIMER_8BIT_TIMER2:
 			//CLEAR MODE AND SET CTC MODE
 			TCCR2 &= ~((1 << WGM21) | (1 << WGM20));
@@ -129,33 +195,39 @@ void AVR_TIMER_Enable_Mode_Ctc(uint8_t timer_num, uint8_t timer_clock)
 			//APPLY CLOCK. START THE TIMER
 			TCCR2 |= timer_clock;
 			break;
+#endif
 			
+#if AVR_TIMER_CONFIG_TIMER1
 		case AVR_TIMER_16BIT_TIMER1:
 			//CLEAR MODE AND SET CTC MODE
 			TCCR1A &= ~((1 << WGM11) | (1 << WGM10));
 			TCCR1B |= (1 << WGM12);
 			//CLEAR COUNT
-			TCNT1 = 0x00;
+			ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+			{
+				TCNT1 = 0x00;
+			}
 			//APPLY CLOCK. START THE TIMER
 			TCCR1B |= timer_clock;
 			break;
+#endif
 
 		default:
-			break;
+			//TIMER0 IN ATMEGA8 DOES NOT HAVE CTC MODE
+			return;
 	}
+	AVR_TIMER_TRACE_MODE(timer_num, AVR_TIMER_TRACE_MODE_CTC);
 }
+#endif
 
+#if AVR_TIMER_ATMEGA8_OCA
 void AVR_TIMER_Set_Oca_parameters(uint8_t timer_num, uint8_t oc_mode, uint16_t top_value, uint8_t interrupt_enable)
 {
 	//SET THE CTC OC-A PARAMETERS FOR THE SPECIFIED TIMER
 	
 	switch(timer_num)
 	{
-		case AVR_TIMER_8BIT_TIMER0:
-			//TIMER0 IN ATMEGA8 DOES NOT HAVE CTC MODE
-			return;
-			break;
-
+#if AVR_TIMER_CONFIG_TIMER2
 		case AVR_TIMER_8BIT_TIMER2:
 			//SET THE OC-A MODE 
 			TCCR2 |= (oc_mode << 4);
@@ -166,55 +238,59 @@ void AVR_TIMER_Set_Oca_parameters(uint8_t timer_num, uint8_t oc_mode, uint16_t t
 				TIMSK |= (1 << OCIE2);
 			}
 			break;
+#endif
 
+#if AVR_TIMER_CONFIG_TIMER1
 		case AVR_TIMER_16BIT_TIMER1:
 			//SET THE OC-A MODE 
 			TCCR1A |= (oc_mode << 6);
 			//SET THE TOP VALUE
-			OCR1A = top_value;
+			ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+			{
+				OCR1A = top_value;
+			}
 			if(interrupt_enable == AVR_TIMER_INTERRUPT_ON)
 			{
 				TIMSK |= (1 << OCIE1A);
 			}
 			break;
+#endif
 			
 		default:
 			break;
 	}
 }
+#endif
 
+#if AVR_TIMER_ATMEGA8_OCB
 void AVR_TIMER_Set_Ocb_parameters(uint8_t timer_num, uint8_t oc_mode, uint16_t top_value, uint8_t interrupt_enable)
 {
 	//SET THE CTC OC-B PARAMETERS FOR THE SPECIFIED TIMER
+	//ONLY TIMER1 HAS AN OC-B CHANNEL ON THE ATMEGA8
 	
 	switch(timer_num)
 	{
-		case AVR_TIMER_8BIT_TIMER0:
-			//TIMER0 IN ATMEGA8 DOES NOT HAVE CTC MODE
-			return;
-			break;
-
-		case AVR_TIMER_8BIT_TIMER2:
-			//SET THE OC-B MODE 
-			//TIMER2 ONLY SUPPORTS OC-A MODE
-			return;
-			break;
-		
+#if AVR_TIMER_CONFIG_TIMER1
 		case AVR_TIMER_16BIT_TIMER1:
 			//SET THE OC-B MODE 
 			TCCR1A |= (oc_mode << 4);
 			//SET THE TOP VALUE
-			OCR1B = top_value;
+			ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+			{
+				OCR1B = top_value;
+			}
 			if(interrupt_enable == AVR_TIMER_INTERRUPT_ON)
 			{
 				TIMSK |= (1 << OCIE1B);
 			}
 			break;
+#endif
 				
 		default:
 			break;
 	}
 }
+#endif
 
 uint8_t AVR_TIMER_Get_Flag_Value(uint8_t timer_num, uint8_t timer_flag)
 {
@@ -222,17 +298,23 @@ uint8_t AVR_TIMER_Get_Flag_Value(uint8_t timer_num, uint8_t timer_flag)
 	
 	switch(timer_num)
 	{
+#if AVR_TIMER_CONFIG_TIMER0
 		case AVR_TIMER_8BIT_TIMER0:
 			return (((TIFR & timer_flag) != 0)? 1 : 0);
 			break;
+#endif
 		
+#if AVR_TIMER_CONFIG_TIMER2
 		case AVR_TIMER_8BIT_TIMER2:
 			return (((TIFR & timer_flag) != 0)? 1 : 0);
 			break;
+#endif
 
+#if AVR_TIMER_CONFIG_TIMER1
 		case AVR_TIMER_16BIT_TIMER1:
 			return (((TIFR & timer_flag) != 0)? 1 : 0);
 			break;
+#endif
 		
 		default:
 			break;
@@ -248,17 +330,23 @@ void AVR_TIMER_Clear_Flag(uint8_t timer_num, uint8_t timer_flag)
 
 	switch(timer_num)
 	{
+#if AVR_TIMER_CONFIG_TIMER0
 		case AVR_TIMER_8BIT_TIMER0:
 			TIFR |= timer_flag;
 			break;
+#endif
 
+#if AVR_TIMER_CONFIG_TIMER2
 		case AVR_TIMER_8BIT_TIMER2:
 			TIFR |= timer_flag;
 			break;
+#endif
 		
+#if AVR_TIMER_CONFIG_TIMER1
 		case AVR_TIMER_16BIT_TIMER1:
 			TIFR |= timer_flag;
 			break;
+#endif
 
 		default:
 			break;
@@ -273,6 +361,7 @@ void AVR_TIMER_Disable(uint8_t timer_num)
 	
 	switch(timer_num)
 	{
+#if AVR_TIMER_CONFIG_TIMER0
 		case AVR_TIMER_8BIT_TIMER0:
 			//STOP CLOCK TO TIMER
 			TCCR0 = 0x00;
@@ -281,7 +370,9 @@ void AVR_TIMER_Disable(uint8_t timer_num)
 			//DISABLE INTERRUPT
 			TIMSK &= ~(1 << TOIE0);
 			break;
+#endif
 		
+#if AVR_TIMER_CONFIG_TIMER2
 		case AVR_TIMER_8BIT_TIMER2:
 			//STOP CLOCK TO TIMER
 			TCCR2 = 0x00;
@@ -289,18 +380,581 @@ void AVR_TIMER_Disable(uint8_t timer_num)
 			TCNT2 = 0;
 			//DISABLE INTERRUPT
 			TIMSK &= ~((1 << TOIE2) | (1 << OCIE2));
+#if AVR_TIMER_CONFIG_RETUNE && AVR_TIMER_CONFIG_ISR
+			//DROP ANY PENDING RETUNE
+			timer2_retune_top = 0;
+#endif
 			break;
+#endif
 		
+#if AVR_TIMER_CONFIG_TIMER1
 		case AVR_TIMER_16BIT_TIMER1:
 			//STOP CLOCK TO TIMER
 			TCCR1B = 0x00;
 			//CLEAR COUNT
-			TCNT1 = 0;
+			ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+			{
+				TCNT1 = 0;
+			}
 			//DISABLE INTERRUPT
-			TIMSK &= ~((1 << TOIE2) | (1 << OCIE1A) | (1 << OCIE1B));
+			TIMSK &= ~((1 << TOIE1) | (1 << OCIE1A) | (1 << OCIE1B));
+#if AVR_TIMER_CONFIG_RETUNE && AVR_TIMER_CONFIG_ISR
+			//DROP ANY PENDING RETUNE
+			timer1_retune_top = 0;
+#endif
 			break;
+#endif
 
 		default:
 			break;
 	}
+	AVR_TIMER_TRACE_MODE(timer_num, AVR_TIMER_TRACE_MODE_DISABLED);
+}
+
+uint16_t AVR_TIMER_Get_Count(uint8_t timer_num)
+{
+	//RETURN THE CURRENT COUNT OF THE SPECIFIED TIMER
+	//THE 16 BIT TIMER1 COUNT IS READ WITH INTERRUPTS OFF
+	//SINCE THE HIGH BYTE TEMP REGISTER IS SHARED WITH ISRs
+	
+	uint16_t count = 0;
+
+	switch(timer_num)
+	{
+#if AVR_TIMER_CONFIG_TIMER0
+		case AVR_TIMER_8BIT_TIMER0:
+			count = TCNT0;
+			break;
+#endif
+
+#if AVR_TIMER_CONFIG_TIMER2
+		case AVR_TIMER_8BIT_TIMER2:
+			count = TCNT2;
+			break;
+#endif
+
+#if AVR_TIMER_CONFIG_TIMER1
+		case AVR_TIMER_16BIT_TIMER1:
+			ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+			{
+				count = TCNT1;
+			}
+			break;
+#endif
+
+		default:
+			break;
+	}
+	return count;
+}
+
+#if AVR_TIMER_CONFIG_RETUNE && AVR_TIMER_ATMEGA8_CTC
+//SMALLEST TOP LEAVING A SAFE WRITE WINDOW, SEE AVR_TIMER_CONFIG.h
+#if AVR_TIMER_CONFIG_ISR
+#define RETUNE_MIN_TOP	(AVR_TIMER_CONFIG_RETUNE_GUARD + AVR_TIMER_CONFIG_RETUNE_ISR_LATENCY)
+#else
+#define RETUNE_MIN_TOP	(2 * AVR_TIMER_CONFIG_RETUNE_GUARD)
+#endif
+
+uint8_t AVR_TIMER_Retune_Ctc(uint8_t timer_num, uint16_t top_value)
+{
+	//CHANGE THE TOP VALUE OF A RUNNING CTC TIMER WITHOUT A MISSED
+	//COMPARE (COUNT ALREADY PAST THE NEW TOP -> FULL WRAPAROUND)
+	//OR A RUNT PERIOD
+	//
+	//IF THE COUNT IS AT LEAST GUARD TICKS BELOW THE NEW TOP, OCR IS
+	//WRITTEN AT ONCE AND THE CURRENT PERIOD ENDS AT THE NEW TOP.
+	//OTHERWISE THE CURRENT PERIOD RUNS TO THE OLD TOP AND THE NEW
+	//TOP IS WRITTEN AT THE COMPARE BOUNDARY:
+	//	--- WITH AVR_TIMER_CONFIG_ISR BY THE COMPARE ISR (RETURNS AT
+	//	    ONCE, OC-A INTERRUPT IS ENABLED). THE NEW TOP MUST EXCEED
+	//	    GUARD + ISR LATENCY SO THE ISR REACHES ITS COUNT CHECK IN
+	//	    TIME. IF A LONGER LATENCY THAN CONFIGURED STILL CARRIES
+	//	    THE COUNT TO WITHIN GUARD TICKS OF THE NEW TOP, THE ISR
+	//	    KEEPS THE OLD TOP FOR ONE MORE PERIOD INSTEAD OF WRAPPING
+	//	--- OTHERWISE BY WAITING HERE FOR THE COUNT TO WRAP. THE
+	//	    NEW TOP MUST EXCEED 2 x GUARD SO THE WRITE WINDOW AFTER
+	//	    THE WRAP IS LONGER THAN ONE POLL OF THE COUNT. A STOPPED
+	//	    TIMER (NO CLOCK) NEVER WRAPS, THE CALL IS REJECTED
+	//EITHER WAY THE CHANGE TAKES EFFECT WITHIN ONE OLD PERIOD
+	//
+	//RETURN AVR_TIMER_RETUNE_APPLIED / SCHEDULED, OR REJECTED IF THE
+	//TOP IS TOO SMALL (SEE AVR_TIMER_CONFIG.h) OR TOO LARGE, THE
+	//TIMER HAS NO CTC MODE OR IT IS STOPPED INSIDE THE GUARD
+	
+	uint8_t result = AVR_TIMER_RETUNE_REJECTED;
+
+	if(top_value <= RETUNE_MIN_TOP)
+	{
+		return result;
+	}
+
+	switch(timer_num)
+	{
+#if AVR_TIMER_CONFIG_TIMER2
+		case AVR_TIMER_8BIT_TIMER2:
+			if(top_value > 0xFF)
+			{
+				break;
+			}
+			//WITHOUT LIBRARY ISRs THIS LOOPS UNTIL THE COUNT WRAPS
+			//OR THE TIMER IS FOUND STOPPED
+			do
+			{
+				ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+				{
+					if(((uint16_t)TCNT2 + AVR_TIMER_CONFIG_RETUNE_GUARD) < top_value)
+					{
+						OCR2 = top_value;
+#if AVR_TIMER_CONFIG_ISR
+						timer2_retune_top = 0;
+#endif
+						result = AVR_TIMER_RETUNE_APPLIED;
+					}
+#if AVR_TIMER_CONFIG_ISR
+					else
+					{
+						timer2_retune_top = top_value;
+						TIMSK |= (1 << OCIE2);
+						result = AVR_TIMER_RETUNE_SCHEDULED;
+					}
+#endif
+				}
+			}while((result == AVR_TIMER_RETUNE_REJECTED) && ((TCCR2 & 0x07) != AVR_TIMER_TIM2_CLOCK_DISABLE));
+			break;
+#endif
+
+#if AVR_TIMER_CONFIG_TIMER1
+		case AVR_TIMER_16BIT_TIMER1:
+			//WITHOUT LIBRARY ISRs THIS LOOPS UNTIL THE COUNT WRAPS
+			//OR THE TIMER IS FOUND STOPPED
+			do
+			{
+				ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+				{
+					if(((uint32_t)TCNT1 + AVR_TIMER_CONFIG_RETUNE_GUARD) < top_value)
+					{
+						OCR1A = top_value;
+#if AVR_TIMER_CONFIG_ISR
+						timer1_retune_top = 0;
+#endif
+						result = AVR_TIMER_RETUNE_APPLIED;
+					}
+#if AVR_TIMER_CONFIG_ISR
+					else
+					{
+						timer1_retune_top = top_value;
+						TIMSK |= (1 << OCIE1A);
+						result = AVR_TIMER_RETUNE_SCHEDULED;
+					}
+#endif
+				}
+			}while((result == AVR_TIMER_RETUNE_REJECTED) && ((TCCR1B & 0x07) != AVR_TIMER_TIM1_CLOCK_DISABLE));
+			break;
+#endif
+
+		default:
+			break;
+	}
+	return result;
+}
+#endif
+
+#if AVR_TIMER_CONFIG_COMPLEMENTARY
+void AVR_TIMER_Enable_Mode_Complementary(uint8_t timer_clock, uint16_t top_value, uint16_t dead_time)
+{
+	//START TIMER1 AS A COMPLEMENTARY PWM PAIR FOR A HALF BRIDGE
+	//
+	//PHASE CORRECT PWM, TOP = ICR1
+	//	OC1A (PB1) = HIGH SIDE, NON INVERTING : HIGH WHILE TCNT1 < OCR1A
+	//	OC1B (PB2) = LOW SIDE, INVERTING : HIGH WHILE TCNT1 >= OCR1B
+	//	OCR1B = OCR1A + DEAD TIME
+	//BOTH OUTPUTS ARE LOW FOR dead_time TIMER TICKS AROUND EACH EDGE
+	//
+	//PWM FREQUENCY = F_CPU / (2 * PRESCALE * top_value)
+	//DEAD TIME (S) = dead_time * PRESCALE / F_CPU
+	//STARTS WITH DUTY 0 (HIGH SIDE OFF)
+	
+	//STOP THE TIMER WHILE RECONFIGURING. THIS ALSO TURNS OFF THE
+	//TIMER1 INTERRUPTS AND DROPS A PENDING RETUNE SO NO ISR CAN
+	//REWRITE OCR1A AND BREAK THE DEAD TIME
+	AVR_TIMER_Disable(AVR_TIMER_16BIT_TIMER1);
+
+	complementary_top = top_value;
+	complementary_dead_time = dead_time;
+	complementary_duty = 0;
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		//THE OC1A / OC1B OUTPUT LATCHES KEEP THEIR STATE ACROSS MODE
+		//CHANGES. A STALE HIGH LATCH FROM AN EARLIER RUN WOULD DRIVE
+		//ITS PIN UNTIL THAT CHANNEL'S FIRST COMPARE, SO BOTH SIDES
+		//COULD BE ON AT ONCE. FORCE BOTH LOW WITH THE TIMER STOPPED IN
+		//NORMAL MODE : CLEAR ON COMPARE, THEN A FORCED COMPARE STROBE
+		TCCR1B = 0x00;
+		TCCR1A = (1 << COM1A1) | (1 << COM1B1);
+		TCCR1A = (1 << COM1A1) | (1 << COM1B1) | (1 << FOC1A) | (1 << FOC1B);
+		TCNT1 = 0x0000;
+		ICR1 = top_value;
+		OCR1A = 0;
+		OCR1B = (dead_time < top_value)? dead_time : top_value;
+	}
+
+	//PHASE CORRECT PWM (MODE 10) FIRST, OUTPUTS ENABLED LAST
+	TCCR1A = (1 << COM1A1) | (1 << COM1B1) | (1 << COM1B0) | (1 << WGM11);
+	DDRB |= (1 << DDB1) | (1 << DDB2);
+	//APPLY CLOCK. START THE TIMER
+	TCCR1B = (1 << WGM13) | timer_clock;
+	AVR_TIMER_TRACE_MODE(AVR_TIMER_16BIT_TIMER1, AVR_TIMER_TRACE_MODE_COMPLEMENTARY);
+}
+
+uint16_t AVR_TIMER_Set_Complementary_Duty(uint16_t duty)
+{
+	//SET THE HIGH SIDE ON TIME (0 TO TOP TICKS) OF THE PAIR AND
+	//RETURN THE VALUE ACTUALLY APPLIED
+	//
+	//DUTY IS CLAMPED TO TOP - DEAD TIME SO OCR1B NEVER PASSES TOP.
+	//OCR1A / OCR1B ARE LATCHED BY HARDWARE AT TOP, WHICH MAY FALL
+	//BETWEEN THE TWO WRITES. THE WRITE ORDER KEEPS OCR1B - OCR1A
+	//>= DEAD TIME FOR THE MIXED OLD / NEW PAIR AS WELL:
+	//	--- DUTY UP : OCR1B FIRST
+	//	--- DUTY DOWN : OCR1A FIRST
+	
+	uint16_t max_duty;
+	uint16_t low_side;
+
+	max_duty = (complementary_dead_time < complementary_top)? (complementary_top - complementary_dead_time) : 0;
+	if(duty > max_duty)
+	{
+		duty = max_duty;
+	}
+	//DEAD TIME >= TOP : BOTH OUTPUTS STAY LOW
+	low_side = (max_duty == 0)? complementary_top : (duty + complementary_dead_time);
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		if(duty > complementary_duty)
+		{
+			OCR1B = low_side;
+			OCR1A = duty;
+		}
+		else
+		{
+			OCR1A = duty;
+			OCR1B = low_side;
+		}
+	}
+	complementary_duty = duty;
+	return duty;
+}
+#endif
+
+#if AVR_TIMER_CONFIG_ISR
+void AVR_TIMER_Set_Callback(uint8_t timer_num, uint8_t timer_event, AVR_TIMER_CALLBACK callback)
+{
+	//REGISTER THE FUNCTION CALLED FROM THE LIBRARY ISR OF THE
+	//SPECIFIED TIMER EVENT. PASS NULL TO REMOVE THE CALLBACK.
+	//THE INTERRUPT ITSELF IS STILL ENABLED THROUGH THE MODE AND
+	//OC CHANNEL FUNCTIONS
+	
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		switch(timer_num)
+		{
+#if AVR_TIMER_CONFIG_TIMER0
+			case AVR_TIMER_8BIT_TIMER0:
+#if AVR_TIMER_CONFIG_MODE_NORMAL
+				if(timer_event == AVR_TIMER_EVENT_OVERFLOW)
+				{
+					timer0_ovf_callback = callback;
+				}
+#endif
+				break;
+#endif
+
+#if AVR_TIMER_CONFIG_TIMER2
+			case AVR_TIMER_8BIT_TIMER2:
+#if AVR_TIMER_CONFIG_MODE_NORMAL
+				if(timer_event == AVR_TIMER_EVENT_OVERFLOW)
+				{
+					timer2_ovf_callback = callback;
+				}
+#endif
+#if AVR_TIMER_CONFIG_OCA
+				if(timer_event == AVR_TIMER_EVENT_OCA_MATCH)
+				{
+					timer2_oca_callback = callback;
+				}
+#endif
+				break;
+#endif
+
+#if AVR_TIMER_CONFIG_TIMER1
+			case AVR_TIMER_16BIT_TIMER1:
+#if AVR_TIMER_CONFIG_MODE_NORMAL
+				if(timer_event == AVR_TIMER_EVENT_OVERFLOW)
+				{
+					timer1_ovf_callback = callback;
+				}
+#endif
+#if AVR_TIMER_CONFIG_OCA && !AVR_TIMER_CONFIG_DAC
+				if(timer_event == AVR_TIMER_EVENT_OCA_MATCH)
+				{
+					timer1_oca_callback = callback;
+				}
+#endif
+#if AVR_TIMER_CONFIG_OCB
+				if(timer_event == AVR_TIMER_EVENT_OCB_MATCH)
+				{
+					timer1_ocb_callback = callback;
+				}
+#endif
+				break;
+#endif
+
+			default:
+				break;
+		}
+	}
+}
+
+//LIBRARY OWNED ISRs. EACH ONE FORWARDS ITS EVENT TO THE
+//REGISTERED CALLBACK
+#if AVR_TIMER_CONFIG_TIMER0 && AVR_TIMER_CONFIG_MODE_NORMAL
+ISR(TIMER0_OVF_vect)
+{
+	AVR_TIMER_TRACE_ISR(AVR_TIMER_8BIT_TIMER0, AVR_TIMER_TRACE_EVENT_OVERFLOW);
+	if(timer0_ovf_callback != NULL)
+	{
+		timer0_ovf_callback(AVR_TIMER_8BIT_TIMER0, AVR_TIMER_EVENT_OVERFLOW);
+	}
+}
+#endif
+
+#if AVR_TIMER_CONFIG_TIMER1 && AVR_TIMER_CONFIG_MODE_NORMAL
+ISR(TIMER1_OVF_vect)
+{
+	AVR_TIMER_TRACE_ISR(AVR_TIMER_16BIT_TIMER1, AVR_TIMER_TRACE_EVENT_OVERFLOW);
+	if(timer1_ovf_callback != NULL)
+	{
+		timer1_ovf_callback(AVR_TIMER_16BIT_TIMER1, AVR_TIMER_EVENT_OVERFLOW);
+	}
+}
+#endif
+
+#if AVR_TIMER_CONFIG_TIMER1 && AVR_TIMER_CONFIG_OCA && !AVR_TIMER_CONFIG_DAC
+ISR(TIMER1_COMPA_vect)
+{
+#if AVR_TIMER_CONFIG_RETUNE
+	if((timer1_retune_top != 0) && (((uint32_t)TCNT1 + AVR_TIMER_CONFIG_RETUNE_GUARD) < timer1_retune_top))
+	{
+		OCR1A = timer1_retune_top;
+		timer1_retune_top = 0;
+	}
+#endif
+	AVR_TIMER_TRACE_ISR(AVR_TIMER_16BIT_TIMER1, AVR_TIMER_TRACE_EVENT_OCA_MATCH);
+	if(timer1_oca_callback != NULL)
+	{
+		timer1_oca_callback(AVR_TIMER_16BIT_TIMER1, AVR_TIMER_EVENT_OCA_MATCH);
+	}
+}
+#endif
+
+#if AVR_TIMER_CONFIG_TIMER1 && AVR_TIMER_CONFIG_OCB
+ISR(TIMER1_COMPB_vect)
+{
+	AVR_TIMER_TRACE_ISR(AVR_TIMER_16BIT_TIMER1, AVR_TIMER_TRACE_EVENT_OCB_MATCH);
+	if(timer1_ocb_callback != NULL)
+	{
+		timer1_ocb_callback(AVR_TIMER_16BIT_TIMER1, AVR_TIMER_EVENT_OCB_MATCH);
+	}
+}
+#endif
+
+#if AVR_TIMER_CONFIG_TIMER2 && AVR_TIMER_CONFIG_MODE_NORMAL
+ISR(TIMER2_OVF_vect)
+{
+	AVR_TIMER_TRACE_ISR(AVR_TIMER_8BIT_TIMER2, AVR_TIMER_TRACE_EVENT_OVERFLOW);
+	if(timer2_ovf_callback != NULL)
+	{
+		timer2_ovf_callback(AVR_TIMER_8BIT_TIMER2, AVR_TIMER_EVENT_OVERFLOW);
+	}
+}
+#endif
+
+#if AVR_TIMER_CONFIG_TIMER2 && AVR_TIMER_CONFIG_OCA
+ISR(TIMER2_COMP_vect)
+{
+#if AVR_TIMER_CONFIG_RETUNE
+	if((timer2_retune_top != 0) && (((uint16_t)TCNT2 + AVR_TIMER_CONFIG_RETUNE_GUARD) < timer2_retune_top))
+	{
+		OCR2 = timer2_retune_top;
+		timer2_retune_top = 0;
+	}
+#endif
+	AVR_TIMER_TRACE_ISR(AVR_TIMER_8BIT_TIMER2, AVR_TIMER_TRACE_EVENT_OCA_MATCH);
+	if(timer2_oca_callback != NULL)
+	{
+		timer2_oca_callback(AVR_TIMER_8BIT_TIMER2, AVR_TIMER_EVENT_OCA_MATCH);
+	}
+}
+#endif
+#endif
+
+#if AVR_TIMER_CONFIG_DAC
+uint8_t AVR_TIMER_Dac_Start(uint32_t sample_rate, AVR_TIMER_DAC_REFILL refill)
+{
+	//START SAMPLE PLAYBACK AT THE SPECIFIED RATE (HZ). THE BUFFER
+	//IS FILLED FROM THE REFILL FUNCTION BEFORE THE SAMPLE CLOCK
+	//STARTS. THE PWM CARRIER IS F_CPU / 256
+	//SAMPLE RATE RANGE : F_CPU / 65536 TO F_CPU / 256
+	//RETURN 1 IF PLAYBACK STARTED, 0 IF THE RATE IS OUT OF RANGE
+	//(THE TIMERS ARE LEFT UNTOUCHED)
+	
+	uint32_t divisor;
+
+	if(sample_rate == 0)
+	{
+		return 0;
+	}
+	divisor = F_CPU / sample_rate;
+	if((divisor < 256) || (divisor > 65536UL))
+	{
+		return 0;
+	}
+
+	AVR_TIMER_Disable(AVR_TIMER_16BIT_TIMER1);
+	dac_head = 0;
+	dac_tail = 0;
+	dac_underruns = 0;
+	dac_refill = refill;
+
+	//TIMER2 FAST PWM (TOP = 0xFF), NON INVERTING ON OC2 (PB3), NO PRESCALE
+	TCCR2 = 0x00;
+	OCR2 = 0x80;
+	DDRB |= (1 << DDB3);
+	TCCR2 = (1 << WGM21) | (1 << WGM20) | (1 << COM21) | AVR_TIMER_TIM2_CLOCK_PRESCALE_NONE;
+	AVR_TIMER_TRACE_MODE(AVR_TIMER_8BIT_TIMER2, AVR_TIMER_TRACE_MODE_FAST_PWM);
+	AVR_TIMER_Dac_Service();
+
+	//TIMER1 CTC SAMPLE CLOCK, NO PRESCALE
+	AVR_TIMER_Set_Oca_parameters(AVR_TIMER_16BIT_TIMER1, AVR_TIMER_OPMODE_OC_NONE, (uint16_t)(divisor - 1), AVR_TIMER_INTERRUPT_ON);
+	AVR_TIMER_Enable_Mode_Ctc(AVR_TIMER_16BIT_TIMER1, AVR_TIMER_TIM1_CLOCK_PRESCALE_NONE);
+	return 1;
+}
+
+void AVR_TIMER_Dac_Stop(void)
+{
+	//STOP THE SAMPLE CLOCK AND THE PWM OUTPUT
+	
+	AVR_TIMER_Disable(AVR_TIMER_16BIT_TIMER1);
+	AVR_TIMER_Disable(AVR_TIMER_8BIT_TIMER2);
+}
+
+uint8_t AVR_TIMER_Dac_Write(const uint8_t* samples, uint8_t length)
+{
+	//COPY UP TO length SAMPLES INTO THE BUFFER WITHOUT BLOCKING
+	//RETURN THE NUMBER OF SAMPLES TAKEN
+	
+	uint8_t head = dac_head;
+	uint8_t space = AVR_TIMER_CONFIG_DAC_BUFFER_SIZE - (uint8_t)(head - dac_tail);
+	uint8_t i;
+
+	if(length > space)
+	{
+		length = space;
+	}
+	for(i = 0; i < length; i++)
+	{
+		dac_buffer[(uint8_t)(head + i) & DAC_BUFFER_MASK] = samples[i];
+	}
+	//SAMPLES MUST BE IN THE BUFFER BEFORE THE ISR CAN SEE THEM
+	__asm__ __volatile__("" ::: "memory");
+	dac_head = head + length;
+	return length;
+}
+
+uint8_t AVR_TIMER_Dac_Service(void)
+{
+	//CALL FROM THE MAIN LOOP. ASK THE REFILL FUNCTION TO WRITE
+	//STRAIGHT INTO THE FREE PART OF THE BUFFER (AT MOST TWO CALLS
+	//: UP TO THE END OF THE BUFFER, THEN FROM ITS START). SPACE
+	//FREED BY THE ISR MEANWHILE IS LEFT FOR THE NEXT CALL. NEVER
+	//BLOCKS
+	//RETURN THE NUMBER OF SAMPLES ADDED
+	
+	uint8_t pass = 0;
+	uint8_t head;
+	uint8_t space;
+	uint8_t chunk;
+	uint8_t written;
+	uint8_t total = 0;
+
+	if(dac_refill == NULL)
+	{
+		return 0;
+	}
+
+	do
+	{
+		head = dac_head;
+		space = AVR_TIMER_CONFIG_DAC_BUFFER_SIZE - (uint8_t)(head - dac_tail);
+		chunk = AVR_TIMER_CONFIG_DAC_BUFFER_SIZE - (head & DAC_BUFFER_MASK);
+		if(chunk > space)
+		{
+			chunk = space;
+		}
+		if(chunk == 0)
+		{
+			break;
+		}
+		written = dac_refill(&dac_buffer[head & DAC_BUFFER_MASK], chunk);
+		if(written > chunk)
+		{
+			written = chunk;
+		}
+		//SAMPLES MUST BE IN THE BUFFER BEFORE THE ISR CAN SEE THEM
+		__asm__ __volatile__("" ::: "memory");
+		dac_head = head + written;
+		total += written;
+	}while((written == chunk) && (++pass < 2));
+	return total;
+}
+
+uint16_t AVR_TIMER_Dac_Get_Underruns(void)
+{
+	//RETURN THE NUMBER OF SAMPLE CLOCKS THAT FOUND THE BUFFER
+	//EMPTY (THE LAST SAMPLE IS HELD ON EACH)
+	
+	uint16_t underruns;
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		underruns = dac_underruns;
+	}
+	return underruns;
+}
+
+//SAMPLE CLOCK ISR. CONSTANT COST : ONE BUFFER READ AND ONE OCR WRITE
+ISR(TIMER1_COMPA_vect)
+{
+	uint8_t tail = dac_tail;
+
+#if AVR_TIMER_CONFIG_RETUNE && AVR_TIMER_CONFIG_ISR
+	if((timer1_retune_top != 0) && (((uint32_t)TCNT1 + AVR_TIMER_CONFIG_RETUNE_GUARD) < timer1_retune_top))
+	{
+		OCR1A = timer1_retune_top;
+		timer1_retune_top = 0;
+	}
+#endif
+	if(tail != dac_head)
+	{
+		OCR2 = dac_buffer[tail & DAC_BUFFER_MASK];
+		dac_tail = tail + 1;
+	}
+	else
+	{
+		dac_underruns++;
+	}
+	AVR_TIMER_TRACE_ISR(AVR_TIMER_16BIT_TIMER1, AVR_TIMER_TRACE_EVENT_OCA_MATCH);
 }
+#endif
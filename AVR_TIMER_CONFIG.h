@@ -0,0 +1,232 @@
+///////////////////////////////////////////////////////
+// AVR TIMER LIBRARY
+// BUILD CONFIGURATION
+//
+// SELECTS THE TIMERS, OUTPUT COMPARE CHANNELS AND MODES
+// THAT ARE COMPILED INTO THE LIBRARY. ANYTHING DISABLED
+// HERE IS REMOVED FROM THE IMAGE TOGETHER WITH ITS API
+// FUNCTION, SWITCH CASES, INTERRUPT VECTORS AND STATE
+//
+// EVERY OPTION IS 1 (ENABLED) OR 0 (DISABLED). EITHER EDIT
+// THE DEFAULTS BELOW OR OVERRIDE THEM ON THE COMPILER
+// COMMAND LINE. EXAMPLE - TIMER1 CTC ONLY BUILD:
+//	-DAVR_TIMER_CONFIG_TIMER0=0
+//	-DAVR_TIMER_CONFIG_TIMER2=0
+//	-DAVR_TIMER_CONFIG_MODE_NORMAL=0
+//	-DAVR_TIMER_CONFIG_OCB=0
+//
+// SIZE REPORT : TEXT / DATA / BSS OF THE DEFAULT, TIMER1 CTC
+// ONLY AND OTHER PRESETS FOR BOTH MCUs WITH THE DELTA AGAINST
+// THE DEFAULT CONFIGURATION:
+//	sh tools/AVR_TIMER_SIZE_REPORT.sh
+//
+// OCTOBER 18, 2026
+///////////////////////////////////////////////////////
+
+#ifndef _AVR_TIMER_CONFIG_H_
+#define _AVR_TIMER_CONFIG_H_
+
+//TIMERS
+#ifndef AVR_TIMER_CONFIG_TIMER0
+#define AVR_TIMER_CONFIG_TIMER0	1
+#endif
+
+#ifndef AVR_TIMER_CONFIG_TIMER1
+#define AVR_TIMER_CONFIG_TIMER1	1
+#endif
+
+#ifndef AVR_TIMER_CONFIG_TIMER2
+#define AVR_TIMER_CONFIG_TIMER2	1
+#endif
+
+//MODES
+#ifndef AVR_TIMER_CONFIG_MODE_NORMAL
+#define AVR_TIMER_CONFIG_MODE_NORMAL	1
+#endif
+
+#ifndef AVR_TIMER_CONFIG_MODE_CTC
+#define AVR_TIMER_CONFIG_MODE_CTC	1
+#endif
+
+//OUTPUT COMPARE CHANNELS
+#ifndef AVR_TIMER_CONFIG_OCA
+#define AVR_TIMER_CONFIG_OCA	1
+#endif
+
+#ifndef AVR_TIMER_CONFIG_OCB
+#define AVR_TIMER_CONFIG_OCB	1
+#endif
+
+//LIBRARY OWNED INTERRUPT VECTORS
+//WHEN ENABLED THE LIBRARY DEFINES THE ISR FOR EVERY ENABLED
+//TIMER EVENT AND DISPATCHES IT TO THE CALLBACK REGISTERED WITH
+//AVR_TIMER_Set_Callback(). LEAVE DISABLED TO WRITE YOUR OWN ISRs
+#ifndef AVR_TIMER_CONFIG_ISR
+#define AVR_TIMER_CONFIG_ISR	0
+#endif
+
+//PHASE CONTINUOUS CTC RETUNE (AVR_TIMER_Retune_Ctc)
+//GUARD IS THE MINIMUM TIMER TICKS LEFT BEFORE THE NEW TOP FOR A
+//WRITE. IT MUST COVER THE TICKS ELAPSED BETWEEN READING THE COUNT
+//AND WRITING OCR (A FEW CYCLES) AND ONE POLL OF THE COUNT WHILE
+//WAITING FOR THE WRAP. 32 COVERS BOTH AT PRESCALE NONE.
+//ISR LATENCY (ONLY WITH AVR_TIMER_CONFIG_ISR) IS THE WORST CASE
+//TICKS FROM A COMPARE MATCH TO THE COUNT CHECK IN ITS ISR : VECTOR
+//AND PROLOGUE (ABOUT 50 CYCLES) PLUS THE LONGEST OTHER ISR OR
+//INTERRUPTS OFF SECTION, DIVIDED BY THE PRESCALE. 64 COVERS THE
+//LIBRARY ALONE AT PRESCALE NONE. A TOP MUST EXCEED:
+//	--- GUARD + ISR LATENCY WITH AVR_TIMER_CONFIG_ISR, SO THE
+//	    COMPARE ISR ALWAYS APPLIES A SCHEDULED TOP AT ONCE
+//	--- 2 x GUARD WITHOUT, SO THE POLLED WRITE WINDOW AFTER THE
+//	    WRAP IS LONGER THAN ONE POLL OF THE COUNT
+#ifndef AVR_TIMER_CONFIG_RETUNE
+#define AVR_TIMER_CONFIG_RETUNE	0
+#endif
+
+#ifndef AVR_TIMER_CONFIG_RETUNE_GUARD
+#define AVR_TIMER_CONFIG_RETUNE_GUARD	32
+#endif
+
+#ifndef AVR_TIMER_CONFIG_RETUNE_ISR_LATENCY
+#define AVR_TIMER_CONFIG_RETUNE_ISR_LATENCY	64
+#endif
+
+//PWM DAC SAMPLE PLAYBACK (AVR_TIMER_Dac_*)
+//TIMER2 FAST PWM IS THE DAC OUTPUT AND TIMER1 CTC IS THE SAMPLE
+//CLOCK. THE TIMER1 OC-A VECTOR IS OWNED BY THE DAC, SO A TIMER1
+//OC-A CALLBACK IS NEVER CALLED AND THE SCHEDULER / COROUTINES
+//(TIMER1 CTC TICK) CANNOT BE ENABLED WITH IT. THE SAMPLE BUFFER
+//SIZE MUST BE A POWER OF 2 FROM 2 TO 128
+#ifndef AVR_TIMER_CONFIG_DAC
+#define AVR_TIMER_CONFIG_DAC	0
+#endif
+
+#ifndef AVR_TIMER_CONFIG_DAC_BUFFER_SIZE
+#define AVR_TIMER_CONFIG_DAC_BUFFER_SIZE	64
+#endif
+
+//COMPLEMENTARY PWM PAIR WITH DEAD TIME ON TIMER1 OC1A / OC1B
+#ifndef AVR_TIMER_CONFIG_COMPLEMENTARY
+#define AVR_TIMER_CONFIG_COMPLEMENTARY	0
+#endif
+
+//TIMER EVENT TRACE (AVR_TIMER_TRACE.c)
+//THE TRACE CLOCK IS READ FOR EVERY RECORD AND MUST COUNT FREELY
+//THROUGH ITS FULL RANGE (E.G. A TIMER IN NORMAL MODE). TRACE ITS
+//OVERFLOW EVENT TOO SO NO GAP BETWEEN RECORDS EXCEEDS ONE WRAP.
+//THE DEFAULT CLOCK TCNT1 THEREFORE RULES OUT ANY OTHER USE OF
+//TIMER1 : THE DAC AND COMPLEMENTARY PWM ARE REJECTED WITH IT, AND
+//A SCHEDULER / COROUTINE TICK MUST NOT RUN ON TIMER1 CTC. PICK
+//ANOTHER FREE RUNNING TIMER (E.G. TCNT0, 8 BITS) FOR THOSE.
+//A 16 BIT CLOCK IS READ THROUGH THE TIMER1 TEMP REGISTER IN EVERY
+//TRACED ISR, SO MAIN LINE 16 BIT TIMER1 ACCESSES OUTSIDE THE
+//LIBRARY MUST BE DONE WITH INTERRUPTS OFF.
+//THE BUFFER SIZE MUST BE A POWER OF 2 FROM 2 TO 128
+#ifndef AVR_TIMER_CONFIG_TRACE
+#define AVR_TIMER_CONFIG_TRACE	0
+#endif
+
+#ifndef AVR_TIMER_CONFIG_TRACE_BUFFER_SIZE
+#define AVR_TIMER_CONFIG_TRACE_BUFFER_SIZE	32
+#endif
+
+#ifndef AVR_TIMER_CONFIG_TRACE_CLOCK
+#define AVR_TIMER_CONFIG_TRACE_CLOCK	TCNT1
+#define AVR_TIMER_CONFIG_TRACE_CLOCK_DEFAULT	1
+#endif
+
+#ifndef AVR_TIMER_CONFIG_TRACE_CLOCK_BITS
+#define AVR_TIMER_CONFIG_TRACE_CLOCK_BITS	16
+#endif
+
+//RATE MONOTONIC TASK SCHEDULER (AVR_TIMER_SCHEDULER.c)
+#ifndef AVR_TIMER_CONFIG_SCHEDULER
+#define AVR_TIMER_CONFIG_SCHEDULER	0
+#endif
+
+#ifndef AVR_TIMER_CONFIG_SCHEDULER_MAX_TASKS
+#define AVR_TIMER_CONFIG_SCHEDULER_MAX_TASKS	4
+#endif
+
+//STACKLESS COROUTINES (AVR_TIMER_CORO.c)
+//AVR_TIMER_CORO_AWAIT_TICKS WALKS THE SLEEP LIST WITH INTERRUPTS
+//OFF, SO THE WORST CASE INTERRUPT LATENCY GROWS BY ONE LIST STEP
+//(ROUGHLY 20 CYCLES) PER SLEEPING COROUTINE. THE LIMIT IS 32
+#ifndef AVR_TIMER_CONFIG_CORO
+#define AVR_TIMER_CONFIG_CORO	0
+#endif
+
+#ifndef AVR_TIMER_CONFIG_CORO_MAX
+#define AVR_TIMER_CONFIG_CORO_MAX	8
+#endif
+
+//SANITY CHECKS
+#if !AVR_TIMER_CONFIG_TIMER0 && !AVR_TIMER_CONFIG_TIMER1 && !AVR_TIMER_CONFIG_TIMER2
+#error "AVR_TIMER_CONFIG : AT LEAST ONE TIMER MUST BE ENABLED"
+#endif
+
+#if AVR_TIMER_CONFIG_MODE_CTC && !AVR_TIMER_CONFIG_OCA
+#error "AVR_TIMER_CONFIG : CTC MODE REQUIRES THE OC-A CHANNEL (TOP = OCRA)"
+#endif
+
+#if AVR_TIMER_CONFIG_RETUNE && !AVR_TIMER_CONFIG_MODE_CTC
+#error "AVR_TIMER_CONFIG : RETUNE REQUIRES CTC MODE"
+#endif
+
+#if AVR_TIMER_CONFIG_RETUNE && ((AVR_TIMER_CONFIG_RETUNE_GUARD < 1) || (AVR_TIMER_CONFIG_RETUNE_GUARD > 126))
+#error "AVR_TIMER_CONFIG : RETUNE GUARD MUST BE FROM 1 TO 126"
+#endif
+
+#if AVR_TIMER_CONFIG_RETUNE && AVR_TIMER_CONFIG_ISR && ((AVR_TIMER_CONFIG_RETUNE_GUARD + AVR_TIMER_CONFIG_RETUNE_ISR_LATENCY) > 254)
+#error "AVR_TIMER_CONFIG : RETUNE GUARD + ISR LATENCY MUST BE AT MOST 254"
+#endif
+
+#if AVR_TIMER_CONFIG_DAC && !(AVR_TIMER_CONFIG_TIMER1 && AVR_TIMER_CONFIG_TIMER2 && AVR_TIMER_CONFIG_MODE_CTC)
+#error "AVR_TIMER_CONFIG : DAC REQUIRES TIMER1, TIMER2 AND CTC MODE"
+#endif
+
+#if AVR_TIMER_CONFIG_DAC && ((AVR_TIMER_CONFIG_DAC_BUFFER_SIZE & (AVR_TIMER_CONFIG_DAC_BUFFER_SIZE - 1)) != 0 || AVR_TIMER_CONFIG_DAC_BUFFER_SIZE < 2 || AVR_TIMER_CONFIG_DAC_BUFFER_SIZE > 128)
+#error "AVR_TIMER_CONFIG : DAC BUFFER SIZE MUST BE A POWER OF 2 FROM 2 TO 128"
+#endif
+
+#if AVR_TIMER_CONFIG_DAC && (AVR_TIMER_CONFIG_SCHEDULER || AVR_TIMER_CONFIG_CORO)
+#error "AVR_TIMER_CONFIG : DAC OWNS THE TIMER1 OC-A VECTOR, IT CANNOT BE COMBINED WITH THE SCHEDULER OR COROUTINES"
+#endif
+
+#if AVR_TIMER_CONFIG_COMPLEMENTARY && !AVR_TIMER_CONFIG_TIMER1
+#error "AVR_TIMER_CONFIG : COMPLEMENTARY PWM REQUIRES TIMER1"
+#endif
+
+#if AVR_TIMER_CONFIG_COMPLEMENTARY && AVR_TIMER_CONFIG_DAC
+#error "AVR_TIMER_CONFIG : COMPLEMENTARY PWM AND DAC BOTH USE TIMER1"
+#endif
+
+#if AVR_TIMER_CONFIG_TRACE && ((AVR_TIMER_CONFIG_TRACE_BUFFER_SIZE & (AVR_TIMER_CONFIG_TRACE_BUFFER_SIZE - 1)) != 0 || AVR_TIMER_CONFIG_TRACE_BUFFER_SIZE < 2 || AVR_TIMER_CONFIG_TRACE_BUFFER_SIZE > 128)
+#error "AVR_TIMER_CONFIG : TRACE BUFFER SIZE MUST BE A POWER OF 2 FROM 2 TO 128"
+#endif
+
+#if AVR_TIMER_CONFIG_TRACE && (AVR_TIMER_CONFIG_TRACE_CLOCK_BITS != 8) && (AVR_TIMER_CONFIG_TRACE_CLOCK_BITS != 16)
+#error "AVR_TIMER_CONFIG : TRACE CLOCK MUST BE 8 OR 16 BITS"
+#endif
+
+#if AVR_TIMER_CONFIG_TRACE && defined(AVR_TIMER_CONFIG_TRACE_CLOCK_DEFAULT) && (AVR_TIMER_CONFIG_DAC || AVR_TIMER_CONFIG_COMPLEMENTARY)
+#error "AVR_TIMER_CONFIG : THE DEFAULT TRACE CLOCK TCNT1 DOES NOT RUN FREELY WITH THE DAC OR COMPLEMENTARY PWM, SET AVR_TIMER_CONFIG_TRACE_CLOCK"
+#endif
+
+#if AVR_TIMER_CONFIG_SCHEDULER && !(AVR_TIMER_CONFIG_ISR && AVR_TIMER_CONFIG_MODE_CTC)
+#error "AVR_TIMER_CONFIG : SCHEDULER REQUIRES LIBRARY ISRs AND CTC MODE"
+#endif
+
+#if AVR_TIMER_CONFIG_SCHEDULER && (AVR_TIMER_CONFIG_SCHEDULER_MAX_TASKS > 8)
+#error "AVR_TIMER_CONFIG : SCHEDULER SUPPORTS AT MOST 8 TASKS"
+#endif
+
+#if AVR_TIMER_CONFIG_CORO && !AVR_TIMER_CONFIG_ISR
+#error "AVR_TIMER_CONFIG : COROUTINES REQUIRE LIBRARY ISRs"
+#endif
+
+#if AVR_TIMER_CONFIG_CORO && ((AVR_TIMER_CONFIG_CORO_MAX < 1) || (AVR_TIMER_CONFIG_CORO_MAX > 32))
+#error "AVR_TIMER_CONFIG : 1 TO 32 COROUTINES"
+#endif
+
+#endif
@@ -0,0 +1,132 @@
+///////////////////////////////////////////////////////
+// AVR TIMER LIBRARY
+// DIVISION FREE TICK / TIME CONVERSION
+//
+// CONVERTS TIMER TICKS TO MICROSECONDS OR MILLISECONDS (AND
+// MICROSECONDS TO TICKS) WITHOUT THE 32 BIT SOFTWARE DIVISION.
+// EACH RATIO R = PRESCALE * UNIT / F_CPU IS REPLACED AT COMPILE
+// TIME BY A 16 BIT MULTIPLIER M AND A SHIFT S:
+//	RESULT = (VALUE * M) >> S,	M = ROUND(R * 2^S) < 2^16
+// S IS THE LARGEST SHIFT THAT KEEPS M IN 16 BITS, SO AT RUN TIME
+// THIS IS ONE 16x16 -> 32 BIT MULTIPLY AND A CONSTANT SHIFT
+//
+// ERROR BOUND (AGAINST THE EXACT floor(VALUE * R)):
+//	|ERROR| <= 1 + floor(VALUE * R) / 32768
+//	I.E. AT MOST ONE UNIT PLUS ONE PART IN 32768. WHEN R * 2^S IS
+//	AN INTEGER (E.G. 16MHZ WITH ANY PRESCALE TO MICROSECONDS) THE
+//	RESULT IS EXACT
+//	tools/AVR_TIMER_CONVERT_TEST.c CHECKS THE BOUND FOR EVERY
+//	16 BIT INPUT, TIMER AND PRESCALE AT 1 TO 20 MHZ
+//
+// * F_CPU MUST BE DEFINED
+// * THE PRESCALE ARGUMENT MUST BE A COMPILE TIME CONSTANT
+//   (AVR_TIMER_TIMn_CLOCK_PRESCALE_*) OR THE CONSTANTS ARE
+//   EVALUATED AT RUN TIME
+// * VALUE IS 16 BIT, RESULT IS 32 BIT. FOR *_US_TO_TICKS THE
+//   RATIO F_CPU / (PRESCALE * 1000000) MUST BE BELOW 65536
+//
+//	EXAMPLE USAGE:
+//	uint16_t start = AVR_TIMER_Get_Count(AVR_TIMER_16BIT_TIMER1);
+//	...
+//	uint16_t ticks = AVR_TIMER_Get_Count(AVR_TIMER_16BIT_TIMER1) - start;
+//	uint32_t us = AVR_TIMER_TIM1_TICKS_TO_US(ticks, AVR_TIMER_TIM1_CLOCK_PRESCALE_64);
+//
+// OCTOBER 18, 2026
+///////////////////////////////////////////////////////
+
+#ifndef _AVR_TIMER_CONVERT_H_
+#define _AVR_TIMER_CONVERT_H_
+
+#include "AVR_TIMER.h"
+
+#ifndef F_CPU
+#error "AVR_TIMER_CONVERT : F_CPU MUST BE DEFINED"
+#endif
+
+//CLOCK SELECT SETTING -> PRESCALE DIVISOR
+#define AVR_TIMER_TIM0_PRESCALE_DIVISOR(prescale)	\
+	((prescale) == AVR_TIMER_TIM0_CLOCK_PRESCALE_8 ? 8ULL : \
+	(prescale) == AVR_TIMER_TIM0_CLOCK_PRESCALE_64 ? 64ULL : \
+	(prescale) == AVR_TIMER_TIM0_CLOCK_PRESCALE_256 ? 256ULL : \
+	(prescale) == AVR_TIMER_TIM0_CLOCK_PRESCALE_1024 ? 1024ULL : 1ULL)
+
+#define AVR_TIMER_TIM1_PRESCALE_DIVISOR(prescale)	\
+	((prescale) == AVR_TIMER_TIM1_CLOCK_PRESCALE_8 ? 8ULL : \
+	(prescale) == AVR_TIMER_TIM1_CLOCK_PRESCALE_64 ? 64ULL : \
+	(prescale) == AVR_TIMER_TIM1_CLOCK_PRESCALE_256 ? 256ULL : \
+	(prescale) == AVR_TIMER_TIM1_CLOCK_PRESCALE_1024 ? 1024ULL : 1ULL)
+
+#define AVR_TIMER_TIM2_PRESCALE_DIVISOR(prescale)	\
+	((prescale) == AVR_TIMER_TIM2_CLOCK_PRESCALE_8 ? 8ULL : \
+	(prescale) == AVR_TIMER_TIM2_CLOCK_PRESCALE_32 ? 32ULL : \
+	(prescale) == AVR_TIMER_TIM2_CLOCK_PRESCALE_64 ? 64ULL : \
+	(prescale) == AVR_TIMER_TIM2_CLOCK_PRESCALE_128 ? 128ULL : \
+	(prescale) == AVR_TIMER_TIM2_CLOCK_PRESCALE_256 ? 256ULL : \
+	(prescale) == AVR_TIMER_TIM2_CLOCK_PRESCALE_1024 ? 1024ULL : 1ULL)
+
+//MULTIPLIER FOR RATIO num / den AT SHIFT s (ROUNDED)
+#define AVR_TIMER_CONVERT_MULT_AT(num, den, s)	(((((unsigned long long)(num)) << (s)) + ((den) / 2)) / (den))
+#define AVR_TIMER_CONVERT_FITS(num, den, s)		(AVR_TIMER_CONVERT_MULT_AT(num, den, s) < 65536ULL)
+
+//LARGEST SHIFT (0 - 31) KEEPING THE MULTIPLIER IN 16 BITS
+#define AVR_TIMER_CONVERT_SHIFT(num, den)	\
+	(AVR_TIMER_CONVERT_FITS(num, den, 31)? 31 : \
+	AVR_TIMER_CONVERT_FITS(num, den, 30)? 30 : \
+	AVR_TIMER_CONVERT_FITS(num, den, 29)? 29 : \
+	AVR_TIMER_CONVERT_FITS(num, den, 28)? 28 : \
+	AVR_TIMER_CONVERT_FITS(num, den, 27)? 27 : \
+	AVR_TIMER_CONVERT_FITS(num, den, 26)? 26 : \
+	AVR_TIMER_CONVERT_FITS(num, den, 25)? 25 : \
+	AVR_TIMER_CONVERT_FITS(num, den, 24)? 24 : \
+	AVR_TIMER_CONVERT_FITS(num, den, 23)? 23 : \
+	AVR_TIMER_CONVERT_FITS(num, den, 22)? 22 : \
+	AVR_TIMER_CONVERT_FITS(num, den, 21)? 21 : \
+	AVR_TIMER_CONVERT_FITS(num, den, 20)? 20 : \
+	AVR_TIMER_CONVERT_FITS(num, den, 19)? 19 : \
+	AVR_TIMER_CONVERT_FITS(num, den, 18)? 18 : \
+	AVR_TIMER_CONVERT_FITS(num, den, 17)? 17 : \
+	AVR_TIMER_CONVERT_FITS(num, den, 16)? 16 : \
+	AVR_TIMER_CONVERT_FITS(num, den, 15)? 15 : \
+	AVR_TIMER_CONVERT_FITS(num, den, 14)? 14 : \
+	AVR_TIMER_CONVERT_FITS(num, den, 13)? 13 : \
+	AVR_TIMER_CONVERT_FITS(num, den, 12)? 12 : \
+	AVR_TIMER_CONVERT_FITS(num, den, 11)? 11 : \
+	AVR_TIMER_CONVERT_FITS(num, den, 10)? 10 : \
+	AVR_TIMER_CONVERT_FITS(num, den, 9)? 9 : \
+	AVR_TIMER_CONVERT_FITS(num, den, 8)? 8 : \
+	AVR_TIMER_CONVERT_FITS(num, den, 7)? 7 : \
+	AVR_TIMER_CONVERT_FITS(num, den, 6)? 6 : \
+	AVR_TIMER_CONVERT_FITS(num, den, 5)? 5 : \
+	AVR_TIMER_CONVERT_FITS(num, den, 4)? 4 : \
+	AVR_TIMER_CONVERT_FITS(num, den, 3)? 3 : \
+	AVR_TIMER_CONVERT_FITS(num, den, 2)? 2 : \
+	AVR_TIMER_CONVERT_FITS(num, den, 1)? 1 : 0)
+
+#define AVR_TIMER_CONVERT_MULT(num, den)	\
+	((uint16_t)AVR_TIMER_CONVERT_MULT_AT(num, den, AVR_TIMER_CONVERT_SHIFT(num, den)))
+
+#define AVR_TIMER_CONVERT(value, num, den)	\
+	AVR_TIMER_Convert((value), AVR_TIMER_CONVERT_MULT(num, den), AVR_TIMER_CONVERT_SHIFT(num, den))
+
+static inline uint32_t AVR_TIMER_Convert(uint16_t value, uint16_t mult, uint8_t shift)
+{
+	//(VALUE * MULT) >> SHIFT. 16x16 -> 32 BIT MULTIPLY, NO DIVISION
+	
+	return ((uint32_t)value * mult) >> shift;
+}
+
+//TIMER TICKS -> MICROSECONDS / MILLISECONDS
+#define AVR_TIMER_TIM0_TICKS_TO_US(ticks, prescale)	AVR_TIMER_CONVERT((ticks), AVR_TIMER_TIM0_PRESCALE_DIVISOR(prescale) * 1000000ULL, (unsigned long long)F_CPU)
+#define AVR_TIMER_TIM1_TICKS_TO_US(ticks, prescale)	AVR_TIMER_CONVERT((ticks), AVR_TIMER_TIM1_PRESCALE_DIVISOR(prescale) * 1000000ULL, (unsigned long long)F_CPU)
+#define AVR_TIMER_TIM2_TICKS_TO_US(ticks, prescale)	AVR_TIMER_CONVERT((ticks), AVR_TIMER_TIM2_PRESCALE_DIVISOR(prescale) * 1000000ULL, (unsigned long long)F_CPU)
+
+#define AVR_TIMER_TIM0_TICKS_TO_MS(ticks, prescale)	AVR_TIMER_CONVERT((ticks), AVR_TIMER_TIM0_PRESCALE_DIVISOR(prescale) * 1000ULL, (unsigned long long)F_CPU)
+#define AVR_TIMER_TIM1_TICKS_TO_MS(ticks, prescale)	AVR_TIMER_CONVERT((ticks), AVR_TIMER_TIM1_PRESCALE_DIVISOR(prescale) * 1000ULL, (unsigned long long)F_CPU)
+#define AVR_TIMER_TIM2_TICKS_TO_MS(ticks, prescale)	AVR_TIMER_CONVERT((ticks), AVR_TIMER_TIM2_PRESCALE_DIVISOR(prescale) * 1000ULL, (unsigned long long)F_CPU)
+
+//MICROSECONDS -> TIMER TICKS (E.G. FOR OCR / TOP VALUES)
+#define AVR_TIMER_TIM0_US_TO_TICKS(us, prescale)	AVR_TIMER_CONVERT((us), (unsigned long long)F_CPU, AVR_TIMER_TIM0_PRESCALE_DIVISOR(prescale) * 1000000ULL)
+#define AVR_TIMER_TIM1_US_TO_TICKS(us, prescale)	AVR_TIMER_CONVERT((us), (unsigned long long)F_CPU, AVR_TIMER_TIM1_PRESCALE_DIVISOR(prescale) * 1000000ULL)
+#define AVR_TIMER_TIM2_US_TO_TICKS(us, prescale)	AVR_TIMER_CONVERT((us), (unsigned long long)F_CPU, AVR_TIMER_TIM2_PRESCALE_DIVISOR(prescale) * 1000000ULL)
+
+#endif
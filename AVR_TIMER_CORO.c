@@ -0,0 +1,256 @@
+///////////////////////////////////////////////////////
+// AVR TIMER LIBRARY
+// STACKLESS COROUTINES
+//
+// SEE AVR_TIMER_CORO.h
+//
+// COROUTINES LIVE IN A STATIC TABLE AND ARE LINKED BY
+// TABLE INDEX. A COROUTINE IS ALWAYS IN EXACTLY ONE OF:
+//	1. THE READY QUEUE (FIFO)
+//	2. THE WAIT LIST OF ONE TIMER EVENT (FIFO)
+//	3. THE SLEEP LIST (DELTA LIST SORTED ON WAKEUP TICK)
+//	4. NONE (RUNNING OR FREE)
+// LISTS ARE CHANGED FROM THE MAIN LOOP WITH INTERRUPTS OFF
+// AND FROM THE EVENT ISRs
+//
+// OCTOBER 18, 2026
+///////////////////////////////////////////////////////
+
+#include "AVR_TIMER_CORO.h"
+
+#if AVR_TIMER_CONFIG_CORO
+
+#include <util/atomic.h>
+
+#define CORO_NONE			0xFF
+#define CORO_EVENT_SLOTS	9
+#define CORO_EVENT_SLOT(timer_num, timer_event)	(((timer_num) * 3) + (timer_event))
+#define CORO_EVENT_VALID(timer_num, timer_event)	(((timer_num) < 3) && ((timer_event) < 3))
+
+static AVR_TIMER_CORO coro_table[AVR_TIMER_CONFIG_CORO_MAX];
+static volatile uint8_t coro_ready_head = CORO_NONE;
+static volatile uint8_t coro_ready_tail = CORO_NONE;
+static volatile uint8_t coro_wait_head[CORO_EVENT_SLOTS] = {CORO_NONE, CORO_NONE, CORO_NONE, CORO_NONE, CORO_NONE, CORO_NONE, CORO_NONE, CORO_NONE, CORO_NONE};
+static volatile uint8_t coro_wait_tail[CORO_EVENT_SLOTS];
+static volatile uint8_t coro_sleep_head = CORO_NONE;
+static uint8_t coro_tick_slot = CORO_NONE;
+
+static void coro_ready_append(uint8_t id)
+{
+	//APPEND A COROUTINE TO THE READY QUEUE
+	//CALLER MUST HAVE INTERRUPTS OFF OR BE AN ISR
+	
+	coro_table[id].next = CORO_NONE;
+	if(coro_ready_head == CORO_NONE)
+	{
+		coro_ready_head = id;
+	}
+	else
+	{
+		coro_table[coro_ready_tail].next = id;
+	}
+	coro_ready_tail = id;
+}
+
+static void coro_event(uint8_t timer_num, uint8_t timer_event)
+{
+	//TIMER EVENT ISR CALLBACK. MOVE ALL COROUTINES WAITING ON
+	//THIS EVENT TO THE READY QUEUE IN ONE SPLICE. ON THE TICK
+	//EVENT ALSO ADVANCE THE SLEEP LIST AND WAKE EXPIRED ENTRIES
+	
+	uint8_t slot = CORO_EVENT_SLOT(timer_num, timer_event);
+	uint8_t id;
+
+	if(coro_wait_head[slot] != CORO_NONE)
+	{
+		if(coro_ready_head == CORO_NONE)
+		{
+			coro_ready_head = coro_wait_head[slot];
+		}
+		else
+		{
+			coro_table[coro_ready_tail].next = coro_wait_head[slot];
+		}
+		coro_ready_tail = coro_wait_tail[slot];
+		coro_wait_head[slot] = CORO_NONE;
+	}
+
+	if((slot == coro_tick_slot) && (coro_sleep_head != CORO_NONE))
+	{
+		id = coro_sleep_head;
+		if(coro_table[id].delta != 0)
+		{
+			coro_table[id].delta--;
+		}
+		while((id != CORO_NONE) && (coro_table[id].delta == 0))
+		{
+			coro_sleep_head = coro_table[id].next;
+			coro_ready_append(id);
+			id = coro_sleep_head;
+		}
+	}
+}
+
+uint8_t AVR_TIMER_Coro_Start(AVR_TIMER_CORO_FUNC func)
+{
+	//START A COROUTINE FROM ITS BEGINNING. IT FIRST RUNS ON
+	//THE NEXT AVR_TIMER_Coro_Run CALL. RETURN THE COROUTINE ID
+	//OR AVR_TIMER_CORO_INVALID IF THE TABLE IS FULL
+	
+	uint8_t id;
+
+	for(id = 0; id < AVR_TIMER_CONFIG_CORO_MAX; id++)
+	{
+		if(coro_table[id].func == NULL)
+		{
+			coro_table[id].func = func;
+			coro_table[id].lc = 0;
+			coro_table[id].delta = 0;
+			ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+			{
+				coro_ready_append(id);
+			}
+			return id;
+		}
+	}
+	return AVR_TIMER_CORO_INVALID;
+}
+
+void AVR_TIMER_Coro_Attach(uint8_t timer_num, uint8_t timer_event)
+{
+	//WAKE COROUTINES AWAITING THIS TIMER EVENT FROM ITS ISR
+	//THE EVENT INTERRUPT ITSELF IS ENABLED BY THE USUAL MODE
+	//AND OC CHANNEL FUNCTIONS
+	
+	AVR_TIMER_Set_Callback(timer_num, timer_event, coro_event);
+}
+
+void AVR_TIMER_Coro_Attach_Tick(uint8_t timer_num, uint8_t timer_event)
+{
+	//USE THIS TIMER EVENT AS THE TICK FOR AVR_TIMER_CORO_AWAIT_TICKS
+	//COROUTINES CAN STILL AWAIT THE EVENT ITSELF. AN INVALID TIMER
+	//OR EVENT IS IGNORED
+	
+	if(!CORO_EVENT_VALID(timer_num, timer_event))
+	{
+		return;
+	}
+	coro_tick_slot = CORO_EVENT_SLOT(timer_num, timer_event);
+	AVR_TIMER_Set_Callback(timer_num, timer_event, coro_event);
+}
+
+uint8_t AVR_TIMER_Coro_Run(void)
+{
+	//RESUME THE COROUTINE AT THE HEAD OF THE READY QUEUE
+	//CALL THIS FROM THE MAIN LOOP. RETURN 1 IF A COROUTINE
+	//WAS RESUMED, 0 IF ALL ARE WAITING
+	
+	uint8_t id;
+	uint8_t state;
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		id = coro_ready_head;
+		if(id != CORO_NONE)
+		{
+			coro_ready_head = coro_table[id].next;
+		}
+	}
+	if(id == CORO_NONE)
+	{
+		return 0;
+	}
+
+	state = coro_table[id].func(&coro_table[id]);
+	if(state == AVR_TIMER_CORO_YIELDED)
+	{
+		ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+		{
+			coro_ready_append(id);
+		}
+	}
+	else if(state == AVR_TIMER_CORO_ENDED)
+	{
+		coro_table[id].func = NULL;
+	}
+	//AVR_TIMER_CORO_WAITING : ALREADY LINKED BY THE AWAIT
+	return 1;
+}
+
+void AVR_TIMER_Coro_Wait_Event(AVR_TIMER_CORO* coro, uint8_t timer_num, uint8_t timer_event)
+{
+	//LINK THE COROUTINE INTO THE WAIT LIST OF THE TIMER EVENT
+	//CALLED BY AVR_TIMER_CORO_AWAIT_EVENT. AN INVALID TIMER OR
+	//EVENT HAS NO WAIT LIST, THE COROUTINE IS MADE READY AGAIN
+	//SO THE AWAIT RETURNS AT ONCE
+	
+	uint8_t id = coro - coro_table;
+	uint8_t slot = CORO_EVENT_SLOT(timer_num, timer_event);
+
+	coro->next = CORO_NONE;
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		if(!CORO_EVENT_VALID(timer_num, timer_event))
+		{
+			coro_ready_append(id);
+		}
+		else
+		{
+			if(coro_wait_head[slot] == CORO_NONE)
+			{
+				coro_wait_head[slot] = id;
+			}
+			else
+			{
+				coro_table[coro_wait_tail[slot]].next = id;
+			}
+			coro_wait_tail[slot] = id;
+		}
+	}
+}
+
+void AVR_TIMER_Coro_Wait_Ticks(AVR_TIMER_CORO* coro, uint16_t ticks)
+{
+	//LINK THE COROUTINE INTO THE SLEEP LIST SO IT WAKES AFTER
+	//THE SPECIFIED NUMBER OF TICKS. EACH ENTRY HOLDS ITS DELAY
+	//RELATIVE TO THE ENTRY BEFORE IT. ENTRIES WITH THE SAME
+	//WAKEUP TICK KEEP THEIR ORDER. CALLED BY AVR_TIMER_CORO_AWAIT_TICKS
+	
+	uint8_t id = coro - coro_table;
+	uint8_t prev = CORO_NONE;
+	uint8_t cur;
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		if(ticks == 0)
+		{
+			coro_ready_append(id);
+		}
+		else
+		{
+			cur = coro_sleep_head;
+			while((cur != CORO_NONE) && (coro_table[cur].delta <= ticks))
+			{
+				ticks -= coro_table[cur].delta;
+				prev = cur;
+				cur = coro_table[cur].next;
+			}
+			coro->delta = ticks;
+			coro->next = cur;
+			if(cur != CORO_NONE)
+			{
+				coro_table[cur].delta -= ticks;
+			}
+			if(prev == CORO_NONE)
+			{
+				coro_sleep_head = id;
+			}
+			else
+			{
+				coro_table[prev].next = id;
+			}
+		}
+	}
+}
+
+#endif
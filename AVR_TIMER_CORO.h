@@ -0,0 +1,100 @@
+///////////////////////////////////////////////////////
+// AVR TIMER LIBRARY
+// STACKLESS COROUTINES
+//
+// PROTOTHREAD STYLE COROUTINES THAT CAN AWAIT A TIMER
+// EVENT OR A NUMBER OF TICKS WITHOUT BUSY WAITING. A
+// COROUTINE IS A FUNCTION WHOSE RESUME POINT IS KEPT IN
+// THE 2 BYTE lc FIELD, SO IT NEEDS NO STACK OF ITS OWN
+//
+// WAITING COROUTINES ARE KEPT IN LINKED LISTS:
+//	--- ONE LIST PER TIMER EVENT. THE EVENT ISR MOVES THE
+//	    WHOLE LIST TO THE READY QUEUE IN ONE SPLICE
+//	--- ONE DELTA LIST FOR TICK WAITS. THE TICK ISR ONLY
+//	    LOOKS AT THE HEAD AND POPS EXPIRED ENTRIES
+// SO EVERY WAKEUP COSTS O(1) IN THE ISR. RAM PER COROUTINE
+// IS 7 BYTES (FUNCTION, RESUME POINT, TICK DELTA, LINK)
+//
+// * NEEDS AVR_TIMER_CONFIG_CORO AND AVR_TIMER_CONFIG_ISR
+// * A COROUTINE ONLY WAKES ON EVENTS THAT HAVE BEEN ATTACHED
+//   WITH AVR_TIMER_Coro_Attach / AVR_TIMER_Coro_Attach_Tick.
+//   THE ATTACHED EVENT CALLBACKS ARE OWNED BY THIS MODULE
+// * LOCAL VARIABLES ARE NOT KEPT ACROSS AN AWAIT, USE STATICS
+// * DO NOT USE switch() ACROSS AN AWAIT INSIDE A COROUTINE
+// * AWAITING AN INVALID TIMER / EVENT RETURNS AT ONCE
+// * TICK WAITS RESUME AFTER ticks - 1 TO ticks TICK PERIODS
+//
+//	EXAMPLE USAGE (BLINK WITH 1KHZ TICK ON TIMER1 OC-A):
+//	uint8_t blink(AVR_TIMER_CORO* coro)
+//	{
+//		AVR_TIMER_CORO_BEGIN(coro);
+//		while(1)
+//		{
+//			PORTB ^= (1 << PB0);
+//			AVR_TIMER_CORO_AWAIT_TICKS(coro, 500);
+//		}
+//		AVR_TIMER_CORO_END(coro);
+//	}
+//
+//	AVR_TIMER_Coro_Attach_Tick(AVR_TIMER_16BIT_TIMER1, AVR_TIMER_EVENT_OCA_MATCH);
+//	AVR_TIMER_Set_Oca_parameters(AVR_TIMER_16BIT_TIMER1, AVR_TIMER_OPMODE_OC_NONE, 249, AVR_TIMER_INTERRUPT_ON);
+//	AVR_TIMER_Enable_Mode_Ctc(AVR_TIMER_16BIT_TIMER1, AVR_TIMER_TIM1_CLOCK_PRESCALE_64);
+//	AVR_TIMER_Coro_Start(blink);
+//	sei();
+//	while(1)
+//	{
+//		AVR_TIMER_Coro_Run();
+//	}
+//
+// OCTOBER 18, 2026
+///////////////////////////////////////////////////////
+
+#ifndef _AVR_TIMER_CORO_H_
+#define _AVR_TIMER_CORO_H_
+
+#include "AVR_TIMER.h"
+
+#if AVR_TIMER_CONFIG_CORO
+
+#define AVR_TIMER_CORO_WAITING	0
+#define AVR_TIMER_CORO_YIELDED	1
+#define AVR_TIMER_CORO_ENDED	2
+
+#define AVR_TIMER_CORO_INVALID	0xFF
+
+typedef struct AVR_TIMER_CORO_S AVR_TIMER_CORO;
+typedef uint8_t (*AVR_TIMER_CORO_FUNC)(AVR_TIMER_CORO* coro);
+
+struct AVR_TIMER_CORO_S
+{
+	AVR_TIMER_CORO_FUNC func;
+	uint16_t lc;
+	uint16_t delta;
+	uint8_t next;
+};
+
+#define AVR_TIMER_CORO_BEGIN(coro)	switch((coro)->lc) { case 0:
+
+#define AVR_TIMER_CORO_END(coro)	} (coro)->lc = 0; return AVR_TIMER_CORO_ENDED
+
+#define AVR_TIMER_CORO_YIELD(coro)	\
+	do { (coro)->lc = __LINE__; return AVR_TIMER_CORO_YIELDED; case __LINE__:; } while(0)
+
+#define AVR_TIMER_CORO_AWAIT_EVENT(coro, timer_num, timer_event)	\
+	do { (coro)->lc = __LINE__; AVR_TIMER_Coro_Wait_Event((coro), (timer_num), (timer_event)); \
+	return AVR_TIMER_CORO_WAITING; case __LINE__:; } while(0)
+
+#define AVR_TIMER_CORO_AWAIT_TICKS(coro, ticks)	\
+	do { (coro)->lc = __LINE__; AVR_TIMER_Coro_Wait_Ticks((coro), (ticks)); \
+	return AVR_TIMER_CORO_WAITING; case __LINE__:; } while(0)
+
+uint8_t AVR_TIMER_Coro_Start(AVR_TIMER_CORO_FUNC func);
+void AVR_TIMER_Coro_Attach(uint8_t timer_num, uint8_t timer_event);
+void AVR_TIMER_Coro_Attach_Tick(uint8_t timer_num, uint8_t timer_event);
+uint8_t AVR_TIMER_Coro_Run(void);
+void AVR_TIMER_Coro_Wait_Event(AVR_TIMER_CORO* coro, uint8_t timer_num, uint8_t timer_event);
+void AVR_TIMER_Coro_Wait_Ticks(AVR_TIMER_CORO* coro, uint16_t ticks);
+
+#endif
+
+#endif
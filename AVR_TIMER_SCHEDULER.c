@@ -0,0 +1,255 @@
+///////////////////////////////////////////////////////
+// AVR TIMER LIBRARY
+// RATE MONOTONIC TASK SCHEDULER
+//
+// SEE AVR_TIMER_SCHEDULER.h
+//
+// TASK IDs ARE GIVEN IN ORDER OF AVR_TIMER_Scheduler_Add_Task
+// CALLS. PRIORITY RANKS ARE ASSIGNED AT START BY SORTING THE
+// TASKS ON PERIOD. THE READY SET IS ONE BIT PER RANK SO THE
+// MAIN LOOP PICKS THE HIGHEST PRIORITY READY TASK BY FINDING
+// THE LOWEST SET BIT
+//
+// EXECUTION TIME = ELAPSED TICKS * (TOP + 1) + COUNT DELTA
+//
+// OCTOBER 18, 2026
+///////////////////////////////////////////////////////
+
+#include "AVR_TIMER_SCHEDULER.h"
+
+#if AVR_TIMER_CONFIG_SCHEDULER
+
+#include <util/atomic.h>
+
+#define SCHEDULER_RANK_NONE	0xFF
+
+typedef struct
+{
+	void (*task)(void);
+	uint16_t period;
+	volatile uint16_t countdown;
+	volatile uint16_t misses;
+	uint16_t wcet;
+	uint16_t last;
+	uint16_t runs;
+}AVR_TIMER_SCHEDULER_TASK;
+
+static AVR_TIMER_SCHEDULER_TASK scheduler_tasks[AVR_TIMER_CONFIG_SCHEDULER_MAX_TASKS];
+static uint8_t scheduler_order[AVR_TIMER_CONFIG_SCHEDULER_MAX_TASKS];
+static uint8_t scheduler_task_count;
+static uint8_t scheduler_started;
+static volatile uint8_t scheduler_ready;
+static volatile uint8_t scheduler_running = SCHEDULER_RANK_NONE;
+static volatile uint16_t scheduler_ticks;
+static uint8_t scheduler_timer;
+static uint8_t scheduler_tick_flag;
+static uint32_t scheduler_tick_counts;
+
+static void scheduler_tick(uint8_t timer_num, uint8_t timer_event)
+{
+	//CTC COMPARE ISR CALLBACK. RELEASE EVERY TASK WHOSE PERIOD
+	//HAS ELAPSED. A TASK RELEASED WHILE ITS PREVIOUS INSTANCE
+	//IS STILL READY OR RUNNING HAS MISSED ITS DEADLINE
+	
+	uint8_t rank;
+	uint8_t mask = 0x01;
+	AVR_TIMER_SCHEDULER_TASK* task;
+
+	(void)timer_num;
+	(void)timer_event;
+
+	scheduler_ticks++;
+	for(rank = 0; rank < scheduler_task_count; rank++, mask <<= 1)
+	{
+		task = &scheduler_tasks[scheduler_order[rank]];
+		if(--task->countdown == 0)
+		{
+			task->countdown = task->period;
+			if(((scheduler_ready & mask) != 0) || (scheduler_running == rank))
+			{
+				task->misses++;
+			}
+			scheduler_ready |= mask;
+		}
+	}
+}
+
+static void scheduler_timestamp(uint16_t* ticks, uint16_t* count)
+{
+	//READ THE TICK NUMBER AND TIMER COUNT AS ONE VALUE. IF THE
+	//COMPARE MATCH HAS HAPPENED BUT ITS ISR HAS NOT RUN YET THE
+	//COUNT HAS ALREADY WRAPPED SO THE TICK IS ADVANCED BY ONE
+	
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		*ticks = scheduler_ticks;
+		*count = AVR_TIMER_Get_Count(scheduler_timer);
+		if(AVR_TIMER_Get_Flag_Value(scheduler_timer, scheduler_tick_flag))
+		{
+			(*ticks)++;
+			*count = AVR_TIMER_Get_Count(scheduler_timer);
+		}
+	}
+}
+
+uint8_t AVR_TIMER_Scheduler_Add_Task(void (*task)(void), uint16_t period_ticks)
+{
+	//ADD A PERIODIC TASK RUN EVERY period_ticks SCHEDULER TICKS
+	//RETURN THE TASK ID OR AVR_TIMER_SCHEDULER_INVALID_TASK IF
+	//THE TASK TABLE IS FULL, THE PARAMETERS ARE INVALID OR THE
+	//SCHEDULER IS ALREADY STARTED (PRIORITY RANKS ARE FIXED AT
+	//START, A LATE TASK WOULD HAVE NO RANK)
+	
+	AVR_TIMER_SCHEDULER_TASK* entry;
+
+	if(scheduler_started || (task == NULL) || (period_ticks == 0) || (scheduler_task_count >= AVR_TIMER_CONFIG_SCHEDULER_MAX_TASKS))
+	{
+		return AVR_TIMER_SCHEDULER_INVALID_TASK;
+	}
+
+	entry = &scheduler_tasks[scheduler_task_count];
+	entry->task = task;
+	entry->period = period_ticks;
+	return scheduler_task_count++;
+}
+
+void AVR_TIMER_Scheduler_Start(uint8_t timer_num, uint8_t timer_clock, uint16_t tick_top)
+{
+	//ASSIGN RATE MONOTONIC PRIORITIES AND START THE TICK TIMER
+	//IN CTC MODE. ALL TASKS ARE RELEASED ON THE FIRST TICK
+	
+	uint8_t i;
+	uint8_t j;
+	uint8_t id;
+
+	//INSERTION SORT TASK IDs ON PERIOD. EQUAL PERIODS KEEP
+	//THEIR ADD ORDER
+	for(i = 0; i < scheduler_task_count; i++)
+	{
+		j = i;
+		while((j > 0) && (scheduler_tasks[scheduler_order[j - 1]].period > scheduler_tasks[i].period))
+		{
+			scheduler_order[j] = scheduler_order[j - 1];
+			j--;
+		}
+		scheduler_order[j] = i;
+	}
+
+	for(id = 0; id < scheduler_task_count; id++)
+	{
+		scheduler_tasks[id].countdown = 1;
+	}
+	scheduler_started = 1;
+	scheduler_ready = 0;
+	scheduler_running = SCHEDULER_RANK_NONE;
+	scheduler_ticks = 0;
+	scheduler_timer = timer_num;
+	scheduler_tick_counts = (uint32_t)tick_top + 1;
+#if defined(__AVR_ATmega8__)
+	scheduler_tick_flag = (timer_num == AVR_TIMER_16BIT_TIMER1)? AVR_TIMER_TIM1_FLAG_OCA_MATCH : AVR_TIMER_TIM2_FLAG_OCA_MATCH;
+#else
+	scheduler_tick_flag = AVR_TIMER_FLAG_OCA_MATCH;
+#endif
+
+	AVR_TIMER_Set_Callback(timer_num, AVR_TIMER_EVENT_OCA_MATCH, scheduler_tick);
+	AVR_TIMER_Set_Oca_parameters(timer_num, AVR_TIMER_OPMODE_OC_NONE, tick_top, AVR_TIMER_INTERRUPT_ON);
+	AVR_TIMER_Enable_Mode_Ctc(timer_num, timer_clock);
+}
+
+uint8_t AVR_TIMER_Scheduler_Run(void)
+{
+	//RUN THE HIGHEST PRIORITY READY TASK TO COMPLETION AND
+	//UPDATE ITS EXECUTION TIME STATISTICS. CALL THIS FROM THE
+	//MAIN LOOP. RETURN 1 IF A TASK WAS RUN, 0 IF IDLE
+	
+	uint8_t ready;
+	uint8_t rank = 0;
+	uint8_t mask = 0x01;
+	uint16_t start_ticks;
+	uint16_t start_count;
+	uint16_t end_ticks;
+	uint16_t end_count;
+	uint32_t elapsed;
+	AVR_TIMER_SCHEDULER_TASK* task;
+
+	ready = scheduler_ready;
+	if(ready == 0)
+	{
+		return 0;
+	}
+	while((ready & mask) == 0)
+	{
+		rank++;
+		mask <<= 1;
+	}
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		scheduler_ready &= ~mask;
+		scheduler_running = rank;
+	}
+
+	task = &scheduler_tasks[scheduler_order[rank]];
+	scheduler_timestamp(&start_ticks, &start_count);
+	task->task();
+	scheduler_timestamp(&end_ticks, &end_count);
+	scheduler_running = SCHEDULER_RANK_NONE;
+
+	//END COUNT CAN ONLY BE BELOW START COUNT IF AT LEAST ONE
+	//TICK HAS ELAPSED SO THE UNSIGNED SUM NEVER UNDERFLOWS
+	elapsed = ((uint32_t)(uint16_t)(end_ticks - start_ticks) * scheduler_tick_counts) + end_count - start_count;
+	if(elapsed > 0xFFFF)
+	{
+		elapsed = 0xFFFF;
+	}
+	task->last = (uint16_t)elapsed;
+	if(task->last > task->wcet)
+	{
+		task->wcet = task->last;
+	}
+	task->runs++;
+	return 1;
+}
+
+uint8_t AVR_TIMER_Scheduler_Get_Stats(uint8_t task_id, AVR_TIMER_SCHEDULER_STATS* stats)
+{
+	//COPY THE STATISTICS OF THE SPECIFIED TASK
+	//RETURN 0 IF THE TASK ID IS INVALID
+	
+	AVR_TIMER_SCHEDULER_TASK* task;
+
+	if(task_id >= scheduler_task_count)
+	{
+		return 0;
+	}
+
+	task = &scheduler_tasks[task_id];
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		stats->wcet = task->wcet;
+		stats->last = task->last;
+		stats->runs = task->runs;
+		stats->misses = task->misses;
+	}
+	return 1;
+}
+
+void AVR_TIMER_Scheduler_Reset_Stats(void)
+{
+	//CLEAR THE STATISTICS OF ALL TASKS
+	
+	uint8_t id;
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		for(id = 0; id < scheduler_task_count; id++)
+		{
+			scheduler_tasks[id].wcet = 0;
+			scheduler_tasks[id].last = 0;
+			scheduler_tasks[id].runs = 0;
+			scheduler_tasks[id].misses = 0;
+		}
+	}
+}
+
+#endif
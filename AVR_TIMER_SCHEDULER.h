@@ -0,0 +1,62 @@
+///////////////////////////////////////////////////////
+// AVR TIMER LIBRARY
+// RATE MONOTONIC TASK SCHEDULER
+//
+// COOPERATIVE EXECUTIVE FOR FIXED RATE TASKS. A CTC TICK
+// RELEASES THE TASKS FROM THE COMPARE ISR AND THE MAIN
+// LOOP RUNS THEM IN RATE MONOTONIC ORDER (SHORTER PERIOD
+// = HIGHER PRIORITY). NOTHING IS ALLOCATED, ALL STATE IS
+// SIZED BY AVR_TIMER_CONFIG_SCHEDULER_MAX_TASKS
+//
+// FOR EVERY TASK THE SCHEDULER RECORDS:
+//	--- WORST CASE EXECUTION TIME (TIMER COUNTS)
+//	--- LAST EXECUTION TIME (TIMER COUNTS)
+//	--- NUMBER OF RUNS
+//	--- DEADLINE MISSES (TASK RELEASED AGAIN WHILE ITS
+//	    PREVIOUS INSTANCE WAS STILL PENDING OR RUNNING)
+//
+// * NEEDS AVR_TIMER_CONFIG_SCHEDULER AND AVR_TIMER_CONFIG_ISR
+// * THE TICK TIMER OC-A CHANNEL IS OWNED BY THE SCHEDULER
+// * ADD ALL TASKS BEFORE STARTING THE SCHEDULER. ADD TASK IS
+//   REJECTED ONCE IT IS STARTED
+//
+//	EXAMPLE USAGE (16MHZ, 1KHZ TICK ON TIMER1):
+//	AVR_TIMER_Scheduler_Add_Task(control_1khz, 1);
+//	AVR_TIMER_Scheduler_Add_Task(control_100hz, 10);
+//	AVR_TIMER_Scheduler_Add_Task(ui_10hz, 100);
+//	AVR_TIMER_Scheduler_Start(AVR_TIMER_16BIT_TIMER1, AVR_TIMER_TIM1_CLOCK_PRESCALE_64, 249);
+//	sei();
+//	while(1)
+//	{
+//		AVR_TIMER_Scheduler_Run();
+//	}
+//
+// OCTOBER 18, 2026
+///////////////////////////////////////////////////////
+
+#ifndef _AVR_TIMER_SCHEDULER_H_
+#define _AVR_TIMER_SCHEDULER_H_
+
+#include "AVR_TIMER.h"
+
+#if AVR_TIMER_CONFIG_SCHEDULER
+
+#define AVR_TIMER_SCHEDULER_INVALID_TASK	0xFF
+
+typedef struct
+{
+	uint16_t wcet;
+	uint16_t last;
+	uint16_t runs;
+	uint16_t misses;
+}AVR_TIMER_SCHEDULER_STATS;
+
+uint8_t AVR_TIMER_Scheduler_Add_Task(void (*task)(void), uint16_t period_ticks);
+void AVR_TIMER_Scheduler_Start(uint8_t timer_num, uint8_t timer_clock, uint16_t tick_top);
+uint8_t AVR_TIMER_Scheduler_Run(void);
+uint8_t AVR_TIMER_Scheduler_Get_Stats(uint8_t task_id, AVR_TIMER_SCHEDULER_STATS* stats);
+void AVR_TIMER_Scheduler_Reset_Stats(void);
+
+#endif
+
+#endif
@@ -0,0 +1,63 @@
+///////////////////////////////////////////////////////
+// AVR TIMER LIBRARY
+// TIMER EVENT TRACE
+//
+// SEE AVR_TIMER_TRACE.h
+//
+// OCTOBER 18, 2026
+///////////////////////////////////////////////////////
+
+#include "AVR_TIMER_TRACE.h"
+
+#if AVR_TIMER_CONFIG_TRACE
+
+uint8_t avr_timer_trace_code[AVR_TIMER_CONFIG_TRACE_BUFFER_SIZE];
+uint16_t avr_timer_trace_delta[AVR_TIMER_CONFIG_TRACE_BUFFER_SIZE];
+volatile uint8_t avr_timer_trace_head;
+volatile uint8_t avr_timer_trace_tail;
+volatile uint8_t avr_timer_trace_dropped;
+uint16_t avr_timer_trace_last;
+
+uint8_t AVR_TIMER_Trace_Drain(void (*sink)(uint8_t byte))
+{
+	//SEND ALL BUFFERED RECORDS TO THE BYTE SINK AS ONE FRAME AND
+	//FREE THEM. NOTHING IS SENT IF THERE ARE NO RECORDS AND NONE
+	//WERE DROPPED. RETURN THE NUMBER OF RECORDS SENT
+	
+	uint8_t tail = avr_timer_trace_tail;
+	uint8_t count;
+	uint8_t dropped;
+	uint8_t i;
+	uint8_t index;
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		count = avr_timer_trace_head - tail;
+		dropped = avr_timer_trace_dropped;
+		avr_timer_trace_dropped = 0;
+	}
+	if((count == 0) && (dropped == 0))
+	{
+		return 0;
+	}
+
+	sink(AVR_TIMER_TRACE_SYNC_0);
+	sink(AVR_TIMER_TRACE_SYNC_1);
+	sink(AVR_TIMER_CONFIG_TRACE_CLOCK_BITS);
+	sink(dropped);
+	sink(count);
+	for(i = 0; i < count; i++)
+	{
+		index = (uint8_t)(tail + i) & AVR_TIMER_TRACE_BUFFER_MASK;
+		sink(avr_timer_trace_code[index]);
+		sink((uint8_t)avr_timer_trace_delta[index]);
+		sink((uint8_t)(avr_timer_trace_delta[index] >> 8));
+	}
+
+	//RECORDS MUST BE READ BEFORE THE WRITER CAN REUSE THEM
+	__asm__ __volatile__("" ::: "memory");
+	avr_timer_trace_tail = tail + count;
+	return count;
+}
+
+#endif
@@ -0,0 +1,132 @@
+///////////////////////////////////////////////////////
+// AVR TIMER LIBRARY
+// TIMER EVENT TRACE
+//
+// EVERY TIMER EVENT HANDLED BY THE LIBRARY (OVERFLOW,
+// COMPARE, MODE CHANGE) IS APPENDED TO A LOCK FREE RING
+// BUFFER AS A 3 BYTE RECORD:
+//	--- CODE : TIMER (BITS 7-6), EVENT (BITS 5-3), ARG (BITS 2-0)
+//	--- DELTA : TRACE CLOCK TICKS SINCE THE PREVIOUS RECORD
+//	    (16 BIT, LITTLE ENDIAN, MODULO THE TRACE CLOCK RANGE)
+// THE ISR SIDE IS WRITER ONLY AND THE MAIN LOOP SIDE IS
+// READER ONLY. THE LAST FREE SLOT IS KEPT FOR A LOST RECORD
+// (EVENT 7) : THE FIRST RECORD THAT FINDS THE BUFFER ALMOST
+// FULL IS REPLACED BY IT, LATER ONES ARE DROPPED UNTIL THE
+// READER FREES SPACE. ALL OF THEM ARE COUNTED AS DROPPED.
+// THE LOST RECORD MARKS THE START OF THE GAP. DELTAS ACROSS
+// THE GAP MAY HAVE WRAPPED, SO THE TIMELINE AFTER IT IS NOT
+// EXACT AND INTERVALS MUST NOT BE TAKEN ACROSS IT
+//
+// AVR_TIMER_Trace_Drain() SENDS THE BUFFERED RECORDS TO ANY
+// BYTE SINK AS ONE FRAME:
+//	0xA5 0x5A, CLOCK BITS, DROPPED (SATURATES AT 255), COUNT,
+//	COUNT x RECORD
+// tools/AVR_TIMER_TRACE_DECODE.c TURNS A CAPTURED STREAM OF
+// FRAMES BACK INTO AN ABSOLUTE TIMELINE WITH STATISTICS
+//
+// * NEEDS AVR_TIMER_CONFIG_TRACE. SEE AVR_TIMER_CONFIG.h FOR
+//   THE TRACE CLOCK REQUIREMENTS
+// * WITH A 16 BIT TRACE CLOCK EVERY TRACED ISR USES THE TIMER1
+//   TEMP REGISTER. THE LIBRARY DOES ITS TIMER1 16 BIT ACCESSES
+//   WITH INTERRUPTS OFF, USER CODE MUST DO THE SAME
+// * USER ISRs CAN RECORD THEIR OWN EVENTS WITH
+//   AVR_TIMER_TRACE_ISR(timer_num, event)
+// * INPUT CAPTURE IS NOT DRIVEN BY THE LIBRARY, ITS EVENT
+//   CODE IS RESERVED FOR USER ISRs
+//
+//	EXAMPLE USAGE:
+//	void uart_putc(uint8_t byte);
+//	...
+//	AVR_TIMER_Enable_Mode_Normal(AVR_TIMER_16BIT_TIMER1, AVR_TIMER_TIM1_CLOCK_PRESCALE_8, AVR_TIMER_INTERRUPT_ON);
+//	while(1)
+//	{
+//		AVR_TIMER_Trace_Drain(uart_putc);
+//	}
+//
+// OCTOBER 18, 2026
+///////////////////////////////////////////////////////
+
+#ifndef _AVR_TIMER_TRACE_H_
+#define _AVR_TIMER_TRACE_H_
+
+#include "AVR_TIMER.h"
+
+#define AVR_TIMER_TRACE_EVENT_OVERFLOW	AVR_TIMER_EVENT_OVERFLOW
+#define AVR_TIMER_TRACE_EVENT_OCA_MATCH	AVR_TIMER_EVENT_OCA_MATCH
+#define AVR_TIMER_TRACE_EVENT_OCB_MATCH	AVR_TIMER_EVENT_OCB_MATCH
+#define AVR_TIMER_TRACE_EVENT_CAPTURE	3
+#define AVR_TIMER_TRACE_EVENT_MODE		4
+#define AVR_TIMER_TRACE_EVENT_LOST		7
+
+#define AVR_TIMER_TRACE_MODE_DISABLED		0
+#define AVR_TIMER_TRACE_MODE_NORMAL			1
+#define AVR_TIMER_TRACE_MODE_CTC			2
+#define AVR_TIMER_TRACE_MODE_COMPLEMENTARY	3
+#define AVR_TIMER_TRACE_MODE_FAST_PWM		4
+
+#define AVR_TIMER_TRACE_SYNC_0	0xA5
+#define AVR_TIMER_TRACE_SYNC_1	0x5A
+
+#define AVR_TIMER_TRACE_CODE(timer_num, event, arg)	((uint8_t)(((timer_num) << 6) | ((event) << 3) | (arg)))
+
+#if AVR_TIMER_CONFIG_TRACE
+
+#include <util/atomic.h>
+
+#define AVR_TIMER_TRACE_BUFFER_MASK	(AVR_TIMER_CONFIG_TRACE_BUFFER_SIZE - 1)
+
+extern uint8_t avr_timer_trace_code[AVR_TIMER_CONFIG_TRACE_BUFFER_SIZE];
+extern uint16_t avr_timer_trace_delta[AVR_TIMER_CONFIG_TRACE_BUFFER_SIZE];
+extern volatile uint8_t avr_timer_trace_head;
+extern volatile uint8_t avr_timer_trace_tail;
+extern volatile uint8_t avr_timer_trace_dropped;
+extern uint16_t avr_timer_trace_last;
+
+static inline void AVR_TIMER_Trace_Record(uint8_t code)
+{
+	//APPEND ONE RECORD. CALL WITH INTERRUPTS OFF (ISR CONTEXT)
+	
+	uint8_t head = avr_timer_trace_head;
+	uint8_t used = head - avr_timer_trace_tail;
+	uint16_t now = AVR_TIMER_CONFIG_TRACE_CLOCK;
+
+	if(used < AVR_TIMER_CONFIG_TRACE_BUFFER_SIZE)
+	{
+		if(used == (AVR_TIMER_CONFIG_TRACE_BUFFER_SIZE - 1))
+		{
+			//LAST FREE SLOT : MARK THE GAP. THIS RECORD IS THE FIRST ONE LOST
+			code = AVR_TIMER_TRACE_CODE(0, AVR_TIMER_TRACE_EVENT_LOST, 0);
+			if(avr_timer_trace_dropped != 0xFF)
+			{
+				avr_timer_trace_dropped++;
+			}
+		}
+		avr_timer_trace_code[head & AVR_TIMER_TRACE_BUFFER_MASK] = code;
+		avr_timer_trace_delta[head & AVR_TIMER_TRACE_BUFFER_MASK] = now - avr_timer_trace_last;
+		avr_timer_trace_last = now;
+		//RECORD MUST BE IN THE BUFFER BEFORE THE READER CAN SEE IT
+		__asm__ __volatile__("" ::: "memory");
+		avr_timer_trace_head = head + 1;
+	}
+	else if(avr_timer_trace_dropped != 0xFF)
+	{
+		avr_timer_trace_dropped++;
+	}
+}
+
+#define AVR_TIMER_TRACE_ISR(timer_num, event)	\
+	AVR_TIMER_Trace_Record(AVR_TIMER_TRACE_CODE((timer_num), (event), 0))
+
+#define AVR_TIMER_TRACE_MODE(timer_num, mode)	\
+	do { ATOMIC_BLOCK(ATOMIC_RESTORESTATE) { AVR_TIMER_Trace_Record(AVR_TIMER_TRACE_CODE((timer_num), AVR_TIMER_TRACE_EVENT_MODE, (mode))); } } while(0)
+
+uint8_t AVR_TIMER_Trace_Drain(void (*sink)(uint8_t byte));
+
+#else
+
+#define AVR_TIMER_TRACE_ISR(timer_num, event)	do {} while(0)
+#define AVR_TIMER_TRACE_MODE(timer_num, mode)	do {} while(0)
+
+#endif
+
+#endif
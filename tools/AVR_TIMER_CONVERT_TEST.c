@@ -0,0 +1,146 @@
+///////////////////////////////////////////////////////
+// AVR TIMER LIBRARY
+// TICK / TIME CONVERSION TEST (HOST TOOL)
+//
+// CHECKS EVERY 16 BIT INPUT OF EVERY AVR_TIMER_CONVERT.h
+// CONVERSION (TICKS -> US, TICKS -> MS, US -> TICKS) FOR
+// EVERY TIMER AND PRESCALE AGAINST THE EXACT floor(VALUE * R)
+// AND FAILS IF ANY RESULT IS OUTSIDE THE DOCUMENTED BOUND
+//	|ERROR| <= 1 + floor(VALUE * R) / 32768
+// AT THE COMMON AVR CLOCKS (1, 3.6864, 8, 11.0592, 12,
+// 14.7456, 16, 18.432 AND 20 MHZ). F_CPU IS REDEFINED
+// BETWEEN THE CLOCKS SINCE THE CONVERSION MACROS EXPAND IT
+// WHERE THEY ARE USED
+//
+// BUILD AND RUN (ATMEGAxx8 / ATMEGA8 PRESCALE SETTINGS):
+//	cc -O2 -Itools/host -I. -o avr_timer_convert_test tools/AVR_TIMER_CONVERT_TEST.c && ./avr_timer_convert_test
+//	cc -O2 -D__AVR_ATmega8__ -Itools/host -I. -o avr_timer_convert_test tools/AVR_TIMER_CONVERT_TEST.c && ./avr_timer_convert_test
+//
+// EXIT STATUS IS 0 WHEN ALL CONVERSIONS ARE WITHIN THE BOUND
+//
+// OCTOBER 18, 2026
+///////////////////////////////////////////////////////
+
+//HOST BUILD : USE THE ATMEGAxx8 DRIVER HEADER UNLESS
+//ANOTHER SUPPORTED PART IS GIVEN ON THE COMMAND LINE
+#if !defined(__AVR_ATmega8__) && !defined(__AVR_ATmega328P__)
+#define __AVR_ATmega328P__
+#endif
+
+#define F_CPU	1000000UL
+
+#include <stdio.h>
+#include <stdint.h>
+#include "AVR_TIMER_CONVERT.h"
+
+static unsigned long test_failures;
+
+//CHECK ONE CONVERSION MACRO FOR ALL 16 BIT INPUTS AGAINST
+//floor(VALUE * num / den)
+#define TEST_CONVERSION(convert, prescale, num, den)	\
+	do \
+	{ \
+		uint32_t value; \
+		unsigned long long exact; \
+		unsigned long long result; \
+		unsigned long long error; \
+		for(value = 0; value < 65536UL; value++) \
+		{ \
+			exact = ((unsigned long long)value * (num)) / (den); \
+			result = convert((uint16_t)value, (prescale)); \
+			error = (result > exact)? (result - exact) : (exact - result); \
+			if(error > (1 + (exact / 32768))) \
+			{ \
+				if(test_failures < 10) \
+				{ \
+					printf("FAIL F_CPU=%lu %s PRESCALE=%u VALUE=%lu EXACT=%llu RESULT=%llu\n", \
+						(unsigned long)F_CPU, #convert, (unsigned)(prescale), (unsigned long)value, exact, result); \
+				} \
+				test_failures++; \
+			} \
+		} \
+	}while(0)
+
+//ALL THREE CONVERSIONS OF ONE TIMER AT ONE PRESCALE
+#define TEST_TIMER(n, prescale)	\
+	do \
+	{ \
+		unsigned long long divisor = AVR_TIMER_TIM##n##_PRESCALE_DIVISOR(prescale); \
+		TEST_CONVERSION(AVR_TIMER_TIM##n##_TICKS_TO_US, prescale, divisor * 1000000ULL, (unsigned long long)F_CPU); \
+		TEST_CONVERSION(AVR_TIMER_TIM##n##_TICKS_TO_MS, prescale, divisor * 1000ULL, (unsigned long long)F_CPU); \
+		TEST_CONVERSION(AVR_TIMER_TIM##n##_US_TO_TICKS, prescale, (unsigned long long)F_CPU, divisor * 1000000ULL); \
+	}while(0)
+
+//ONE TEST FUNCTION PER CLOCK, EXPANDED WITH THE F_CPU IN EFFECT
+#define TEST_CLOCK(name)	\
+	static void name(void) \
+	{ \
+		TEST_TIMER(0, AVR_TIMER_TIM0_CLOCK_PRESCALE_NONE); \
+		TEST_TIMER(0, AVR_TIMER_TIM0_CLOCK_PRESCALE_8); \
+		TEST_TIMER(0, AVR_TIMER_TIM0_CLOCK_PRESCALE_64); \
+		TEST_TIMER(0, AVR_TIMER_TIM0_CLOCK_PRESCALE_256); \
+		TEST_TIMER(0, AVR_TIMER_TIM0_CLOCK_PRESCALE_1024); \
+		TEST_TIMER(1, AVR_TIMER_TIM1_CLOCK_PRESCALE_NONE); \
+		TEST_TIMER(1, AVR_TIMER_TIM1_CLOCK_PRESCALE_8); \
+		TEST_TIMER(1, AVR_TIMER_TIM1_CLOCK_PRESCALE_64); \
+		TEST_TIMER(1, AVR_TIMER_TIM1_CLOCK_PRESCALE_256); \
+		TEST_TIMER(1, AVR_TIMER_TIM1_CLOCK_PRESCALE_1024); \
+		TEST_TIMER(2, AVR_TIMER_TIM2_CLOCK_PRESCALE_NONE); \
+		TEST_TIMER(2, AVR_TIMER_TIM2_CLOCK_PRESCALE_8); \
+		TEST_TIMER(2, AVR_TIMER_TIM2_CLOCK_PRESCALE_32); \
+		TEST_TIMER(2, AVR_TIMER_TIM2_CLOCK_PRESCALE_64); \
+		TEST_TIMER(2, AVR_TIMER_TIM2_CLOCK_PRESCALE_128); \
+		TEST_TIMER(2, AVR_TIMER_TIM2_CLOCK_PRESCALE_256); \
+		TEST_TIMER(2, AVR_TIMER_TIM2_CLOCK_PRESCALE_1024); \
+		printf("F_CPU=%lu DONE\n", (unsigned long)F_CPU); \
+	}
+
+TEST_CLOCK(test_1000000)
+
+#undef F_CPU
+#define F_CPU	3686400UL
+TEST_CLOCK(test_3686400)
+
+#undef F_CPU
+#define F_CPU	8000000UL
+TEST_CLOCK(test_8000000)
+
+#undef F_CPU
+#define F_CPU	11059200UL
+TEST_CLOCK(test_11059200)
+
+#undef F_CPU
+#define F_CPU	12000000UL
+TEST_CLOCK(test_12000000)
+
+#undef F_CPU
+#define F_CPU	14745600UL
+TEST_CLOCK(test_14745600)
+
+#undef F_CPU
+#define F_CPU	16000000UL
+TEST_CLOCK(test_16000000)
+
+#undef F_CPU
+#define F_CPU	18432000UL
+TEST_CLOCK(test_18432000)
+
+#undef F_CPU
+#define F_CPU	20000000UL
+TEST_CLOCK(test_20000000)
+
+int main(void)
+{
+	test_1000000();
+	test_3686400();
+	test_8000000();
+	test_11059200();
+	test_12000000();
+	test_14745600();
+	test_16000000();
+	test_18432000();
+	test_20000000();
+
+	printf("%lu FAILURES\n", test_failures);
+	return (test_failures == 0)? 0 : 1;
+}
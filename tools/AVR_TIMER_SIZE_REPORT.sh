@@ -0,0 +1,79 @@
+#!/bin/sh
+#######################################################
+# AVR TIMER LIBRARY
+# BUILD CONFIGURATION SIZE REPORT (HOST TOOL)
+#
+# COMPILES THE LIBRARY FOR EVERY PRESET BELOW ON BOTH THE
+# ATMEGA8 AND THE ATMEGA328P AND PRINTS THE avr-size TEXT /
+# DATA / BSS OF EACH BUILD TOGETHER WITH ITS DELTA AGAINST
+# THE DEFAULT CONFIGURATION OF THE SAME MCU
+#
+# USAGE (FROM ANY DIRECTORY):
+#	sh tools/AVR_TIMER_SIZE_REPORT.sh [EXTRA avr-gcc OPTIONS]
+#
+# ENVIRONMENT:
+#	AVR_GCC		COMPILER, DEFAULT avr-gcc
+#	AVR_SIZE	SIZE TOOL, DEFAULT avr-size
+#	F_CPU		CPU CLOCK, DEFAULT 8000000UL
+#
+# OCTOBER 18, 2026
+#######################################################
+
+set -e
+
+AVR_GCC=${AVR_GCC:-avr-gcc}
+AVR_SIZE=${AVR_SIZE:-avr-size}
+F_CPU=${F_CPU:-8000000UL}
+EXTRA="$*"
+
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+OUT=$(mktemp -d)
+trap 'rm -rf "$OUT"' EXIT
+
+#PRESET NAME | AVR_TIMER_CONFIG OPTIONS
+PRESETS='DEFAULT|
+TIMER1_CTC_ONLY|-DAVR_TIMER_CONFIG_TIMER0=0 -DAVR_TIMER_CONFIG_TIMER2=0 -DAVR_TIMER_CONFIG_MODE_NORMAL=0 -DAVR_TIMER_CONFIG_OCB=0
+TIMER0_NORMAL_ONLY|-DAVR_TIMER_CONFIG_TIMER1=0 -DAVR_TIMER_CONFIG_TIMER2=0 -DAVR_TIMER_CONFIG_MODE_CTC=0 -DAVR_TIMER_CONFIG_OCA=0 -DAVR_TIMER_CONFIG_OCB=0
+NO_OCB|-DAVR_TIMER_CONFIG_OCB=0
+NO_TIMER1|-DAVR_TIMER_CONFIG_TIMER1=0
+ISR|-DAVR_TIMER_CONFIG_ISR=1
+ISR_RETUNE|-DAVR_TIMER_CONFIG_ISR=1 -DAVR_TIMER_CONFIG_RETUNE=1
+DAC|-DAVR_TIMER_CONFIG_DAC=1
+COMPLEMENTARY|-DAVR_TIMER_CONFIG_COMPLEMENTARY=1
+SCHEDULER|-DAVR_TIMER_CONFIG_ISR=1 -DAVR_TIMER_CONFIG_SCHEDULER=1
+CORO|-DAVR_TIMER_CONFIG_ISR=1 -DAVR_TIMER_CONFIG_CORO=1'
+
+for MCU in atmega8 atmega328p
+do
+	case $MCU in
+		atmega8)	DRIVER=AVR_TIMER_ATMEGA8.c ;;
+		*)		DRIVER=AVR_TIMER_ATMEGA328.c ;;
+	esac
+
+	echo "$MCU (F_CPU=$F_CPU)"
+	printf '%-20s %7s %7s %7s %8s %8s %8s\n' PRESET TEXT DATA BSS dTEXT dDATA dBSS
+
+	echo "$PRESETS" | while IFS='|' read -r NAME OPTIONS
+	do
+		OBJS=""
+		for SRC in $DRIVER AVR_TIMER_TRACE.c AVR_TIMER_SCHEDULER.c AVR_TIMER_CORO.c
+		do
+			OBJ="$OUT/$MCU-$NAME-${SRC%.c}.o"
+			#shellcheck disable=SC2086
+			"$AVR_GCC" -mmcu=$MCU -Os -DF_CPU=$F_CPU $OPTIONS $EXTRA -I"$ROOT" -c "$ROOT/$SRC" -o "$OBJ"
+			OBJS="$OBJS $OBJ"
+		done
+
+		#LAST LINE OF avr-size -t IS THE TOTAL : TEXT DATA BSS DEC HEX
+		#shellcheck disable=SC2086
+		"$AVR_SIZE" -t $OBJS | tail -n 1 > "$OUT/$MCU-$NAME.size"
+		read -r T D B REST < "$OUT/$MCU-$NAME.size"
+		if [ "$NAME" = DEFAULT ]
+		then
+			cp "$OUT/$MCU-$NAME.size" "$OUT/$MCU.base"
+		fi
+		read -r BT BD BB REST < "$OUT/$MCU.base"
+		printf '%-20s %7d %7d %7d %+8d %+8d %+8d\n' "$NAME" "$T" "$D" "$B" $((T - BT)) $((D - BD)) $((B - BB))
+	done
+	echo
+done
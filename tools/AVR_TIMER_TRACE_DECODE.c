@@ -0,0 +1,279 @@
+///////////////////////////////////////////////////////
+// AVR TIMER LIBRARY
+// TRACE DECODER (LINUX HOST TOOL)
+//
+// READS A CAPTURED STREAM OF AVR_TIMER_Trace_Drain() FRAMES
+// (SEE AVR_TIMER_TRACE.h) AND PRINTS THE ABSOLUTE TIMELINE
+// OF TIMER EVENTS FOLLOWED BY PER EVENT STATISTICS
+// (COUNT, MIN / MAX / MEAN INTERVAL) AND THE NUMBER OF
+// DROPPED RECORDS. BYTES OUTSIDE FRAMES ARE SKIPPED SO THE
+// CAPTURE CAN START MID STREAM
+//
+// A LOST RECORD, OR A FRAME WITH A NON ZERO DROPPED COUNT,
+// IS A GAP IN THE TIMELINE : TIMES AFTER THE FIRST GAP ARE
+// MARKED '~' (NOT EXACT) AND NO INTERVAL IS TAKEN ACROSS A GAP
+//
+// BUILD:
+//	cc -O2 -o avr_timer_trace_decode tools/AVR_TIMER_TRACE_DECODE.c
+//
+// USAGE:
+//	avr_timer_trace_decode [-n NS_PER_TICK] [-q] [FILE]
+//		-n	CONVERT TRACE CLOCK TICKS TO MICROSECONDS
+//			(E.G. 500 FOR 16MHZ / PRESCALE 8)
+//		-q	STATISTICS ONLY, NO TIMELINE
+//		FILE	CAPTURE FILE, DEFAULT STDIN
+//
+//	stty -F /dev/ttyUSB0 raw 115200; cat /dev/ttyUSB0 | avr_timer_trace_decode -n 500
+//
+// OCTOBER 18, 2026
+///////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+#define TRACE_SYNC_0		0xA5
+#define TRACE_SYNC_1		0x5A
+#define TRACE_TIMERS		4
+#define TRACE_EVENTS		8
+#define TRACE_EVENT_MODE	4
+#define TRACE_EVENT_LOST	7
+
+typedef struct
+{
+	uint64_t count;
+	uint64_t intervals;
+	uint64_t gap;
+	uint64_t last;
+	uint64_t min;
+	uint64_t max;
+	uint64_t sum;
+}TRACE_STATS;
+
+static const char* trace_event_names[TRACE_EVENTS] = {"OVF", "OCA", "OCB", "CAPTURE", "MODE", "EV5", "EV6", "LOST"};
+static const char* trace_mode_names[8] = {"DISABLED", "NORMAL", "CTC", "COMPLEMENTARY", "FAST_PWM", "MODE5", "MODE6", "MODE7"};
+
+static TRACE_STATS trace_stats[TRACE_TIMERS][TRACE_EVENTS];
+static double trace_ns_per_tick = 0.0;
+static int trace_quiet = 0;
+static uint64_t trace_gaps = 0;
+
+static void trace_print_time(FILE* out, uint64_t ticks)
+{
+	if(trace_ns_per_tick > 0.0)
+	{
+		fprintf(out, "%14.3f us", ((double)ticks * trace_ns_per_tick) / 1000.0);
+	}
+	else
+	{
+		fprintf(out, "%14llu ticks", (unsigned long long)ticks);
+	}
+}
+
+static void trace_gap(void)
+{
+	//START A NEW INTERVAL EPOCH. EVENTS BEFORE THE GAP ARE NOT
+	//PAIRED WITH EVENTS AFTER IT
+	trace_gaps++;
+}
+
+static void trace_record(uint64_t now, uint8_t code)
+{
+	uint8_t timer = code >> 6;
+	uint8_t event = (code >> 3) & 0x07;
+	uint8_t arg = code & 0x07;
+	TRACE_STATS* stats = &trace_stats[timer][event];
+	uint64_t interval;
+
+	if(event == TRACE_EVENT_LOST)
+	{
+		stats->count++;
+		if(!trace_quiet)
+		{
+			printf("%c", (trace_gaps != 0)? '~' : ' ');
+			trace_print_time(stdout, now);
+			printf("  ** RECORDS LOST, TIMELINE GAP **\n");
+		}
+		trace_gap();
+		return;
+	}
+
+	if((stats->count != 0) && (stats->gap == trace_gaps))
+	{
+		interval = now - stats->last;
+		if((stats->intervals == 0) || (interval < stats->min))
+		{
+			stats->min = interval;
+		}
+		if(interval > stats->max)
+		{
+			stats->max = interval;
+		}
+		stats->sum += interval;
+		stats->intervals++;
+	}
+	stats->gap = trace_gaps;
+	stats->last = now;
+	stats->count++;
+
+	if(!trace_quiet)
+	{
+		printf("%c", (trace_gaps != 0)? '~' : ' ');
+		trace_print_time(stdout, now);
+		printf("  TIMER%u  %-7s", timer, trace_event_names[event]);
+		if(event == TRACE_EVENT_MODE)
+		{
+			printf("  %s", trace_mode_names[arg]);
+		}
+		printf("\n");
+	}
+}
+
+int main(int argc, char** argv)
+{
+	FILE* in = stdin;
+	int opt;
+	int c;
+	int i;
+	uint8_t clock_bits;
+	uint8_t dropped;
+	uint8_t count;
+	uint8_t record[3];
+	uint16_t mask;
+	uint64_t now = 0;
+	uint64_t frames = 0;
+	uint64_t records = 0;
+	uint64_t dropped_total = 0;
+	int lost;
+	uint8_t timer;
+	uint8_t event;
+	TRACE_STATS* stats;
+
+	while((opt = getopt(argc, argv, "n:q")) != -1)
+	{
+		switch(opt)
+		{
+			case 'n':
+				trace_ns_per_tick = atof(optarg);
+				break;
+
+			case 'q':
+				trace_quiet = 1;
+				break;
+
+			default:
+				fprintf(stderr, "usage: %s [-n NS_PER_TICK] [-q] [FILE]\n", argv[0]);
+				return 2;
+		}
+	}
+	if(optind < argc)
+	{
+		in = fopen(argv[optind], "rb");
+		if(in == NULL)
+		{
+			perror(argv[optind]);
+			return 1;
+		}
+	}
+
+	//FIND SYNC, READ HEADER, READ RECORDS. A TRUNCATED FRAME AT
+	//THE END OF THE CAPTURE IS IGNORED
+	while((c = fgetc(in)) != EOF)
+	{
+		if(c != TRACE_SYNC_0)
+		{
+			continue;
+		}
+		c = fgetc(in);
+		if(c != TRACE_SYNC_1)
+		{
+			if(c == TRACE_SYNC_0)
+			{
+				ungetc(c, in);
+			}
+			continue;
+		}
+		if(((c = fgetc(in)) == EOF) || ((c != 8) && (c != 16)))
+		{
+			continue;
+		}
+		clock_bits = (uint8_t)c;
+		mask = (clock_bits == 8)? 0x00FF : 0xFFFF;
+		if((c = fgetc(in)) == EOF)
+		{
+			break;
+		}
+		dropped = (uint8_t)c;
+		if((c = fgetc(in)) == EOF)
+		{
+			break;
+		}
+		count = (uint8_t)c;
+
+		frames++;
+		dropped_total += dropped;
+		lost = 0;
+		for(i = 0; i < count; i++)
+		{
+			if(fread(record, 1, sizeof(record), in) != sizeof(record))
+			{
+				break;
+			}
+			now += (uint16_t)(record[1] | (record[2] << 8)) & mask;
+			trace_record(now, record[0]);
+			records++;
+			lost = (((record[0] >> 3) & 0x07) == TRACE_EVENT_LOST);
+		}
+		//THE DROPPED COUNT IS TAKEN WHEN THE FRAME IS SENT, AFTER ITS
+		//RECORDS. A GAP NOT ALREADY MARKED BY A TRAILING LOST RECORD
+		//(DROPS WHILE THE PREVIOUS FRAME WAS SENT) STARTS HERE
+		if(dropped != 0)
+		{
+			if(!trace_quiet)
+			{
+				printf("%*s  ** %u RECORDS DROPPED **\n", 21, "", dropped);
+			}
+			if(!lost)
+			{
+				trace_gap();
+			}
+		}
+	}
+
+	printf("\n%llu FRAMES, %llu RECORDS, %llu DROPPED, %llu GAPS, SPAN %c", (unsigned long long)frames, (unsigned long long)records, (unsigned long long)dropped_total, (unsigned long long)trace_gaps, (trace_gaps != 0)? '~' : ' ');
+	trace_print_time(stdout, now);
+	if(trace_gaps != 0)
+	{
+		printf("\nTIMELINE IS DISCONTINUOUS : '~' TIMES ARE NOT EXACT, INTERVALS ARE NOT TAKEN ACROSS GAPS");
+	}
+	printf("\n\n%-7s %-8s %10s %20s %20s %20s\n", "TIMER", "EVENT", "COUNT", "MIN INTERVAL", "MAX INTERVAL", "MEAN INTERVAL");
+	for(timer = 0; timer < TRACE_TIMERS; timer++)
+	{
+		for(event = 0; event < TRACE_EVENTS; event++)
+		{
+			stats = &trace_stats[timer][event];
+			if(stats->count == 0)
+			{
+				continue;
+			}
+			printf("TIMER%-2u %-8s %10llu ", timer, trace_event_names[event], (unsigned long long)stats->count);
+			if(stats->intervals != 0)
+			{
+				trace_print_time(stdout, stats->min);
+				printf(" ");
+				trace_print_time(stdout, stats->max);
+				printf(" ");
+				trace_print_time(stdout, stats->sum / stats->intervals);
+			}
+			printf("\n");
+		}
+	}
+
+	if(in != stdin)
+	{
+		fclose(in);
+	}
+	return 0;
+}
@@ -0,0 +1,18 @@
+///////////////////////////////////////////////////////
+// AVR TIMER LIBRARY
+// HOST STAND IN FOR <avr/io.h>
+//
+// LETS THE HOST SIDE TESTS IN tools/ INCLUDE THE LIBRARY
+// HEADERS (CONSTANTS AND MACROS ONLY) WITH A NATIVE COMPILER.
+// NO REGISTERS ARE DECLARED, THE DRIVER SOURCES DO NOT BUILD
+// AGAINST IT
+//
+// OCTOBER 18, 2026
+///////////////////////////////////////////////////////
+
+#ifndef _AVR_TIMER_HOST_AVR_IO_H_
+#define _AVR_TIMER_HOST_AVR_IO_H_
+
+#include <stdint.h>
+
+#endif